@@ -121,8 +121,27 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_setup = FALSE      // reuse the hypre grid, matrices, and solver setup when possible
  \endverbatim
  *
+ * When \p reuse_hypre_setup is enabled, the hypre data structures are retained
+ * by deallocateSolverState(), and subsequent calls to initializeSolverState()
+ * only rebuild those parts of the hypre state that are actually invalidated.
+ * The grid, stencil, matrices, and vectors are rebuilt only when the local
+ * patch layout of the level changes.  When the layout is unchanged but the
+ * matrix coefficients differ from those used in the previous setup (e.g.
+ * because the PoissonSpecifications were changed by a new time step size),
+ * only the matrix values are reset and the hypre solver setup is redone.  When
+ * neither has changed, the existing solver setup is reused as-is.  The matrix
+ * coefficients are compared exactly against a copy of those used in the
+ * previous setup.
+ *
+ * \note Reuse is disabled by default.  When it is enabled, the hypre grid,
+ * matrices, vectors, and solver setup remain allocated between solves, and the
+ * solver also stores a full second copy of the matrix coefficients of the
+ * level.  When it is disabled, all of these data are freed by
+ * deallocateSolverState().
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -284,8 +303,9 @@ private:
      * data structures.
      */
     void allocateHypreData();
-    void setMatrixCoefficients_aligned();
-    void setMatrixCoefficients_nonaligned();
+    void setMatrixCoefficients_aligned(std::vector<double>& all_mat_vals);
+    void setMatrixCoefficients_nonaligned(std::vector<double>& all_mat_vals);
+    void assembleHypreMatrices();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
@@ -335,6 +355,20 @@ private:
     int d_skip_relax;
     int d_two_norm;
     //\}
+
+    /*!
+     * \name Data used to determine whether the hypre data structures and solver
+     * setup may be reused by initializeSolverState().
+     *
+     * \note d_cached_matrix_coefs is a full copy of the matrix coefficients of
+     * the level.  It is retained between solves only when reuse is enabled.
+     */
+    //\{
+    bool d_reuse_hypre_setup;
+    bool d_hypre_data_cached;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_patch_boxes;
+    std::vector<double> d_cached_matrix_coefs;
+    //\}
 };
 } // namespace IBTK
 
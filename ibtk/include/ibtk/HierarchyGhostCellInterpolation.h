@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <list>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -89,6 +90,15 @@ namespace IBTK
  * \note In cases where physical boundary conditions are set via extrapolation
  * from interior values, setting ghost cell values may require both coarsening
  * and refining.
+ *
+ * \note Operators frequently alternate between a small number of collections
+ * of transaction components, e.g., by temporarily resetting the components to
+ * fill ghost cells of an operand and then restoring the original components.
+ * To avoid rebuilding communication schedules each time the components are
+ * reset, schedules created for a collection of components that recurs are kept
+ * in a small cache and are reused by resetTransactionComponents().  The cache
+ * is cleared whenever the operator state is (re)initialized or deallocated,
+ * e.g., following regridding.
  */
 class HierarchyGhostCellInterpolation : public SAMRAI::tbox::DescribedClass
 {
@@ -337,6 +347,18 @@ public:
      */
     void fillData(double fill_time);
 
+    /*!
+     * \brief Return the number of calls to resetTransactionComponents() that
+     * reused cached communication schedules.
+     */
+    int getNumberOfScheduleCacheHits() const;
+
+    /*!
+     * \brief Return the number of calls to resetTransactionComponents() that
+     * could not reuse cached communication schedules.
+     */
+    int getNumberOfScheduleCacheMisses() const;
+
 protected:
 private:
     /*!
@@ -359,6 +381,51 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that);
 
+    /*!
+     * \brief Communication schedules and boundary condition handlers for a
+     * collection of transaction components that is not currently in use.
+     */
+    struct ScheduleCacheEntry
+    {
+        ScheduleCacheEntry();
+
+        std::vector<InterpolationTransactionComponent> d_transaction_comps;
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
+        SAMRAI::xfer::CoarsenPatchStrategy<NDIM>* d_coarsen_strategy;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_refine_alg;
+        SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
+        std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
+        std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
+        std::vector<SAMRAI::tbox::Pointer<CartCellRobinPhysBdryOp> > d_cc_robin_bc_ops;
+        std::vector<SAMRAI::tbox::Pointer<CartSideRobinPhysBdryOp> > d_sc_robin_bc_ops;
+    };
+
+    /*!
+     * \brief Create the communication algorithms, schedules, and boundary
+     * condition handlers for the current transaction components.
+     */
+    void createOperatorState();
+
+    /*!
+     * \brief Exchange the communication schedules and boundary condition
+     * handlers that are currently in use with those stored in a cache entry.
+     */
+    void swapOperatorState(ScheduleCacheEntry& entry);
+
+    /*!
+     * \brief Free the data stored in a cache entry.
+     */
+    static void deallocateScheduleCacheEntry(ScheduleCacheEntry& entry);
+
+    /*!
+     * \brief Determine whether two collections of transaction components
+     * require the same communication schedules and boundary condition handlers.
+     */
+    static bool equivalentTransactionComponents(const std::vector<InterpolationTransactionComponent>& comps1,
+                                                const std::vector<InterpolationTransactionComponent>& comps2);
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized;
 
@@ -388,6 +455,13 @@ private:
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
     std::vector<SAMRAI::tbox::Pointer<CartCellRobinPhysBdryOp> > d_cc_robin_bc_ops;
     std::vector<SAMRAI::tbox::Pointer<CartSideRobinPhysBdryOp> > d_sc_robin_bc_ops;
+
+    // Cached schedules for recurring transaction components that are not
+    // currently in use, ordered from most to least recently used, and the
+    // most recently requested transaction components.
+    std::list<ScheduleCacheEntry> d_schedule_cache;
+    std::list<std::vector<InterpolationTransactionComponent> > d_recent_transaction_comps;
+    int d_schedule_cache_hits, d_schedule_cache_misses;
 };
 } // namespace IBTK
 
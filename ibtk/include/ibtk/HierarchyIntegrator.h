@@ -182,6 +182,26 @@ public:
      */
     double getMaximumTimeStepSize();
 
+    /*!
+     * Return an estimate of the relative error committed during the current
+     * time step.  The estimate is the maximum of the estimates provided by the
+     * integrator object and all of its child integrators.
+     *
+     * This method must be called after the final cycle of the time step and
+     * before postprocessIntegrateHierarchy().
+     *
+     * Subclasses can control the method used to estimate the error by
+     * overriding the protected virtual member function
+     * getTimeStepErrorEstimateSpecialized().
+     */
+    double getTimeStepErrorEstimate();
+
+    /*!
+     * Return the total number of time steps that have been rejected by the
+     * adaptive time step size controller.
+     */
+    int getNumberOfRejectedTimeSteps() const;
+
     /*!
      * Synchronize data defined on the grid hierarchy.
      *
@@ -565,6 +585,23 @@ protected:
      */
     virtual double getMaximumTimeStepSizeSpecialized();
 
+    /*!
+     * Virtual method to compute an implementation-specific estimate of the
+     * relative error committed during the current time step.
+     *
+     * A default implementation is provided that returns zero, which indicates
+     * that the integrator does not provide an error estimate.
+     */
+    virtual double getTimeStepErrorEstimateSpecialized();
+
+    /*!
+     * Return a boolean value that indicates whether the outermost integrator
+     * object uses adaptive time step size control, in which case subclasses
+     * should provide error estimates via
+     * getTimeStepErrorEstimateSpecialized().
+     */
+    bool usingAdaptiveTimeStepping() const;
+
     /*!
      * Virtual method to perform implementation-specific data synchronization.
      *
@@ -876,6 +913,28 @@ protected:
      */
     int d_num_cycles;
 
+    /*
+     * Parameters for adaptive time step size control.
+     *
+     * When adaptive time stepping is enabled, the relative error estimate
+     * returned by getTimeStepErrorEstimate() is compared to the error
+     * tolerance at the end of each time step.  Time steps with errors that
+     * exceed the tolerance are rejected and repeated with a smaller time step
+     * size.  A proportional-integral (PI) controller determines the next time
+     * step size from the errors of the two most recent time steps.
+     */
+    bool d_enable_adaptive_time_stepping;
+    double d_dt_error_tol, d_dt_safety_factor, d_dt_pi_alpha, d_dt_pi_beta, d_dt_min_reduction_factor;
+    int d_max_dt_rejections;
+
+    /*
+     * The time step size proposed by the adaptive time step size controller,
+     * the normalized error of the last accepted time step, and the total number
+     * of rejected time steps.
+     */
+    double d_dt_adaptive, d_dt_error_ratio_previous;
+    int d_num_rejected_time_steps;
+
     /*
      * The number of cycles for the current time step, the current cycle number,
      * and the current time step size.
@@ -1007,6 +1066,19 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Reset the number of cycles, the cycle number, and the time step size of
+     * the current time step for this integrator and all child integrators.
+     */
+    void resetCurrentTimeStepData();
+
+    /*!
+     * Return the factor by which the adaptive time step size controller scales
+     * the time step size, given the normalized errors of the current and
+     * preceding time steps.
+     */
+    double computeTimeStepSizeFactor(double error_ratio, double error_ratio_previous, bool step_rejected) const;
+
     /*
      * Indicates whether we are currently regridding the hierarchy, or whether
      * the time step began by regridding the hierarchy.
@@ -92,6 +92,9 @@ namespace IBTK
  * "composite-grid" mathematical operations on a range of levels in a
  * SAMRAI::hier::PatchHierarchy object.
  *
+ * The patch-local operations on each level are distributed across threads
+ * using IBTK::ParallelPatchFor when IBTK is built with OpenMP enabled.
+ *
  * \note All specified variable descriptor indices must refer to
  * SAMRAI::hier::Variable / SAMRAI::hier::VariableContext pairs that have been
  * registered with the SAMRAI::hier::VariableDatabase.
@@ -1149,6 +1152,22 @@ public:
                           int src_idx,
                           SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeVariable<NDIM, double> > src_var);
 
+    /*!
+     * \brief Synchronize side-centered data on the coarse-fine interface
+     * between the specified level and the next coarser level.
+     *
+     * Coarse values on the coarse-fine interface are replaced by the
+     * restriction of the overlying fine values.  This is the synchronization
+     * performed by the side-centered differencing operators, and it is
+     * provided for classes that evaluate their own patch kernels.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void synchronizeCoarseFineInterface(int data_idx,
+                                        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > data_var,
+                                        int ln);
+
 private:
     /*!
      * \brief Default constructor.
@@ -634,6 +634,28 @@ public:
      */
     std::pair<int, int> getLagrangianStructureIndexRange(int structure_id, int level_number) const;
 
+    /*!
+     * \brief Get the IDs of the Lagrangian structures associated with the
+     * local nodes of the specified level, indexed by local PETSc index.
+     *
+     * \note Entries are -1 for nodes that are not associated with any
+     * Lagrangian structure.  The array is recomputed whenever the data are
+     * redistributed, so references to it are invalidated by regridding.
+     */
+    const std::vector<int>& getLocalLagrangianStructureIDs(int level_number) const;
+
+    /*!
+     * \brief Get the local PETSc indices of the local nodes of the specified
+     * level that are associated with the Lagrangian structure with the
+     * specified ID.
+     *
+     * \note The indices are returned in increasing order.  An empty array is
+     * returned in the case that no local node is associated with the
+     * specified structure.  The array is recomputed whenever the data are
+     * redistributed, so references to it are invalidated by regridding.
+     */
+    const std::vector<int>& getLocalLagrangianStructureNodeIndices(int structure_id, int level_number) const;
+
     /*!
      * \brief Get the center of mass of the Lagrangian structure with the
      * specified ID.
@@ -787,6 +809,16 @@ public:
      */
     void endDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Return the number of times that the Lagrangian data have been
+     * redistributed.
+     *
+     * Local PETSc indices and the assignment of nodes to cells remain fixed
+     * between redistributions, so that this count may be used to determine
+     * when data derived from the data distribution must be recomputed.
+     */
+    unsigned int getNumberOfDataRedistributions() const;
+
     /*!
      * \brief Update the workload and count of nodes per cell.
      *
@@ -996,6 +1028,16 @@ private:
                                  unsigned int& node_offset,
                                  int level_number);
 
+    /*!
+     * Determine the Lagrangian structure associated with each local node of
+     * the specified level, along with the lists of local nodes associated with
+     * each structure.
+     *
+     * \note This method must be called whenever the local Lagrangian indices
+     * or the Lagrangian structure index ranges of the level change.
+     */
+    void computeLocalStructureIndexing(int level_number);
+
     /*!
      * Determine the number of local Lagrangian nodes on all MPI processes with
      * rank less than the rank of the current MPI process.
@@ -1124,6 +1166,11 @@ private:
      */
     SAMRAI::hier::ComponentSelector d_current_data, d_scratch_data;
 
+    /*
+     * The number of completed data redistributions.
+     */
+    unsigned int d_num_data_redistributions;
+
     /*!
      * \name Data that is separately maintained for each level of the patch
      * hierarchy.
@@ -1143,6 +1190,14 @@ private:
     std::vector<std::vector<LNodeSet::value_type> > d_displaced_strct_lnode_idxs;
     std::vector<std::vector<Point> > d_displaced_strct_lnode_posns;
 
+    /*!
+     * The IDs of the Lagrangian structures associated with the local nodes
+     * (indexed by local PETSc index) and the local PETSc indices of the nodes
+     * associated with each structure.
+     */
+    std::vector<std::vector<int> > d_local_strct_ids;
+    std::vector<std::map<int, std::vector<int> > > d_strct_id_to_local_petsc_idxs_map;
+
     /*!
      * Lagrangian mesh data.
      */
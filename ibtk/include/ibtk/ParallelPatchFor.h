@@ -0,0 +1,170 @@
+// Filename: ParallelPatchFor.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_ParallelPatchFor
+#define included_IBTK_ParallelPatchFor
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ParallelPatchFor distributes the local patches of a patch level
+ * across the threads of the calling process.
+ *
+ * A ParallelPatchFor object collects the local patches of a level, ordered by
+ * decreasing number of cells, and is used together with the
+ * IBTK_PARALLEL_PATCH_FOR macro:
+ *
+ * \code
+ * const ParallelPatchFor patch_for(level);
+ * IBTK_PARALLEL_PATCH_FOR(k, patch_for)
+ * {
+ *     Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
+ *     ...
+ * }
+ * \endcode
+ *
+ * When IBTK is compiled with OpenMP enabled, the iterations of the loop are
+ * handed out one patch at a time to the threads of the OpenMP thread pool, so
+ * that the largest patches are processed first and the remaining patches
+ * balance the load.  Otherwise, the loop is executed serially and visits the
+ * patches in the same order as SAMRAI::hier::PatchLevel::Iterator.
+ *
+ * \note The body of the loop must only access data associated with the patch
+ * being processed, and must not copy SAMRAI::tbox::Pointer objects that refer
+ * to objects shared between patches (e.g., variables, boundary condition
+ * objects, or communication schedules), because reference counting is not
+ * thread safe.  For the same reason, the body of the loop must not construct
+ * temporary SAMRAI patch data objects, which all refer to the shared standard
+ * memory arena; temporary patch-local arrays should instead be obtained from
+ * an IBTK::PatchDataWorkspace.  Other scratch storage shared between patches
+ * must be allocated per thread, e.g., using getThreadNumber() and
+ * getMaxNumberOfThreads().
+ */
+class ParallelPatchFor
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    ParallelPatchFor(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ParallelPatchFor();
+
+    /*!
+     * \brief Return the number of local patches.
+     */
+    int getNumberOfPatches() const;
+
+    /*!
+     * \brief Return the local patch processed by the specified loop iteration.
+     */
+    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& getPatch(int k) const;
+
+    /*!
+     * \brief Return the maximum number of threads that may execute a parallel
+     * patch loop.
+     */
+    static int getMaxNumberOfThreads();
+
+    /*!
+     * \brief Return the number of the calling thread, which is between 0 and
+     * getMaxNumberOfThreads()-1.
+     */
+    static int getThreadNumber();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    ParallelPatchFor();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ParallelPatchFor(const ParallelPatchFor& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ParallelPatchFor& operator=(const ParallelPatchFor& that);
+
+    // The local patches in the order in which they are handed out.
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > d_patches;
+};
+} // namespace IBTK
+
+/////////////////////////////// MACROS ///////////////////////////////////////
+
+#if defined(_OPENMP)
+#define IBTK_PARALLEL_PATCH_FOR(k, patch_for)                                                                          \
+    _Pragma("omp parallel for schedule(dynamic, 1)") for (int k = 0; k < (patch_for).getNumberOfPatches(); ++k)
+#else
+#define IBTK_PARALLEL_PATCH_FOR(k, patch_for) for (int k = 0; k < (patch_for).getNumberOfPatches(); ++k)
+#endif
+
+// IBTK_PARALLEL_FOR(k, n) loops over k = 0, ..., n-1 and, when IBTK is compiled
+// with OpenMP enabled, hands out contiguous blocks of iterations to the threads
+// of the OpenMP thread pool.  The restrictions on the body of an
+// IBTK_PARALLEL_PATCH_FOR loop also apply to the body of this loop.
+#if defined(_OPENMP)
+#define IBTK_PARALLEL_FOR(k, n) _Pragma("omp parallel for schedule(static)") for (int k = 0; k < (n); ++k)
+#else
+#define IBTK_PARALLEL_FOR(k, n) for (int k = 0; k < (n); ++k)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ParallelPatchFor
@@ -0,0 +1,239 @@
+// Filename: PatchDataWorkspace.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PatchDataWorkspace
+#define included_IBTK_PatchDataWorkspace
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <list>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "boost/array.hpp"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchDataWorkspace provides reusable storage for temporary
+ * patch-local cell-centered, face-centered, and side-centered arrays.
+ *
+ * Operators that evaluate patch kernels often need temporary arrays that live
+ * only while a single patch is processed.  Rather than allocating new
+ * SAMRAI::pdat::CellData, SAMRAI::pdat::FaceData, or SAMRAI::pdat::SideData
+ * objects for every patch, an operator may own a PatchDataWorkspace, size it
+ * once when the operator state is initialized, and carve temporary arrays out
+ * of it for each patch.
+ *
+ * The arrays use the same memory layout as the corresponding SAMRAI patch
+ * data, so that their data pointers may be passed directly to Fortran
+ * kernels.  All arrays obtained from the workspace are invalidated by the
+ * next call to reset() or clear().
+ *
+ * The workspace keeps separate storage for each thread that may execute an
+ * IBTK::ParallelPatchFor loop.  reserve() and clear() act on the storage of
+ * all threads and must be called outside of such loops, whereas reset() and
+ * the methods that obtain temporary arrays act on the storage of the calling
+ * thread.
+ */
+class PatchDataWorkspace
+{
+public:
+    /*!
+     * \brief Class DataView provides access to a cell-centered,
+     * face-centered, or side-centered array stored in a PatchDataWorkspace.
+     *
+     * The interface mirrors the parts of the SAMRAI::pdat::FaceData and
+     * SAMRAI::pdat::SideData interfaces that are used to call Fortran kernels.
+     * Cell-centered data has a single component, which corresponds to axis 0.
+     */
+    class DataView
+    {
+    public:
+        /*!
+         * \brief Default constructor.
+         */
+        DataView();
+
+        /*!
+         * \brief Return a pointer to the specified depth of the data for the
+         * specified component (axis).
+         */
+        double* getPointer(int axis, int depth = 0) const;
+
+        /*!
+         * \brief Return the ghost cell width of the data.
+         */
+        const SAMRAI::hier::IntVector<NDIM>& getGhostCellWidth() const;
+
+        /*!
+         * \brief Return the depth of the data.
+         */
+        int getDepth() const;
+
+    private:
+        friend class PatchDataWorkspace;
+
+        boost::array<double*, NDIM> d_ptrs;
+        boost::array<size_t, NDIM> d_depth_offsets;
+        SAMRAI::hier::IntVector<NDIM> d_ghosts;
+        int d_depth;
+    };
+
+    /*!
+     * \brief Default constructor.
+     */
+    PatchDataWorkspace();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchDataWorkspace();
+
+    /*!
+     * \brief Return the number of values required to store face-centered or
+     * side-centered data with the specified box, depth, and ghost cell width.
+     */
+    static size_t getDataSize(const SAMRAI::hier::Box<NDIM>& box,
+                              int depth,
+                              const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Return the number of values required to store cell-centered data
+     * with the specified box, depth, and ghost cell width.
+     */
+    static size_t getCellDataSize(const SAMRAI::hier::Box<NDIM>& box,
+                                  int depth,
+                                  const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Ensure that the workspace of each thread can store at least the
+     * specified number of values without further memory allocation.
+     */
+    void reserve(size_t size);
+
+    /*!
+     * \brief Release all arrays obtained by the calling thread without freeing
+     * the underlying storage.
+     *
+     * If the arrays requested since the last call to reset() did not fit in
+     * the reserved storage, the storage is enlarged here so that subsequent
+     * requests of the same size do not allocate memory.
+     */
+    void reset();
+
+    /*!
+     * \brief Release all arrays and free the underlying storage.
+     */
+    void clear();
+
+    /*!
+     * \brief Obtain temporary cell-centered data with the specified box,
+     * depth, and ghost cell width.
+     */
+    DataView getCellData(const SAMRAI::hier::Box<NDIM>& box, int depth, const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Obtain temporary face-centered data with the specified box,
+     * depth, and ghost cell width.
+     */
+    DataView getFaceData(const SAMRAI::hier::Box<NDIM>& box, int depth, const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Obtain temporary side-centered data with the specified box,
+     * depth, and ghost cell width.
+     */
+    DataView getSideData(const SAMRAI::hier::Box<NDIM>& box, int depth, const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchDataWorkspace(const PatchDataWorkspace& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchDataWorkspace& operator=(const PatchDataWorkspace& that);
+
+    /*!
+     * \brief Obtain storage for an array with one component per axis.
+     */
+    DataView getData(const SAMRAI::hier::Box<NDIM>& box, int depth, const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * \brief Obtain a contiguous block of memory of the specified size.
+     */
+    double* allocate(size_t size);
+
+    /*!
+     * \brief Storage used by a single thread.
+     */
+    struct ThreadStorage
+    {
+        ThreadStorage();
+
+        // Primary storage and the offset of the first unused value.
+        std::vector<double> d_buffer;
+        size_t d_offset;
+
+        // Storage for requests that did not fit in the primary storage.
+        std::list<std::vector<double> > d_overflow_buffers;
+        size_t d_overflow_size;
+    };
+
+    /*!
+     * \brief Return the storage of the calling thread.
+     */
+    ThreadStorage& getThreadStorage();
+
+    // Storage indexed by thread number.
+    std::vector<ThreadStorage> d_thread_storage;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchDataWorkspace
@@ -0,0 +1,134 @@
+// Filename: PoissonSmoothers.h
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PoissonSmoothers
+#define included_IBTK_PoissonSmoothers
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PoissonSmoothers provides cache-blocked point relaxation
+ * smoothers for the standard (2*NDIM+1)-point discretization of \f$ f =
+ * \alpha \nabla^2 u + \beta u \f$.
+ *
+ * The red-black Gauss-Seidel smoother fuses several consecutive half sweeps
+ * into a wavefront that moves through the patch one plane of cells at a time,
+ * so that each cell is loaded from memory once per group of fused sweeps
+ * instead of once per half sweep.  In three spatial dimensions, each plane is
+ * additionally split into skewed tiles of rows so that the working set of the
+ * wavefront remains in cache.  The cells of a given color in each row are
+ * updated in chunks through a packed buffer, so that the inner loop carries no
+ * dependencies and can be vectorized.
+ *
+ * Ghost cell values are held fixed while the fused half sweeps are performed.
+ * Up to roundoff, the result is identical to performing the half sweeps one
+ * after another without refilling ghost cell values between them.
+ */
+class PoissonSmoothers
+{
+public:
+    /*!
+     * The default number of rows in each tile.
+     */
+    static const int DEFAULT_TILE_SIZE = 16;
+
+    /*!
+     * \brief Perform \a num_half_sweeps red-black Gauss-Seidel half sweeps on
+     * the cells of \a box, beginning with the color \a first_color (0 for
+     * "red" cells, for which the sum of the cell indices is even, and 1 for
+     * "black" cells) and alternating colors thereafter.
+     *
+     * Degrees of freedom at which \a mask is nonzero are not modified.  The
+     * mask is optional and may be NULL.
+     */
+    static void redBlackGaussSeidelSmooth(SAMRAI::pdat::ArrayData<NDIM, double>& U,
+                                          const SAMRAI::pdat::ArrayData<NDIM, double>& F,
+                                          const SAMRAI::pdat::ArrayData<NDIM, int>* mask,
+                                          int depth,
+                                          const SAMRAI::hier::Box<NDIM>& box,
+                                          const double* dx,
+                                          double alpha,
+                                          double beta,
+                                          int first_color,
+                                          int num_half_sweeps,
+                                          int tile_size = DEFAULT_TILE_SIZE);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PoissonSmoothers();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PoissonSmoothers(const PoissonSmoothers& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PoissonSmoothers& operator=(const PoissonSmoothers& that);
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PoissonSmoothers
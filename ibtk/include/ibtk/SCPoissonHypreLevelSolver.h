@@ -118,8 +118,23 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by SysPFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_setup = FALSE      // reuse the hypre grid, matrix, and solver setup when possible
  \endverbatim
  *
+ * When \p reuse_hypre_setup is enabled, the hypre data structures are retained
+ * by deallocateSolverState().  A subsequent call to initializeSolverState()
+ * rebuilds the grid, graph, matrix, and vectors only when the local patch
+ * layout of the level has changed, and it redoes the hypre solver setup only
+ * when the matrix coefficients differ from those used in the previous setup.
+ * The matrix coefficients are compared exactly against a copy of those used in
+ * the previous setup.
+ *
+ * \note Reuse is disabled by default.  When it is enabled, the hypre grid,
+ * graph, matrix, vectors, and solver setup remain allocated between solves, and
+ * the solver also stores a full second copy of the matrix coefficients of the
+ * level.  When it is disabled, all of these data are freed by
+ * deallocateSolverState().
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -281,7 +296,7 @@ private:
      * data structures.
      */
     void allocateHypreData();
-    void setMatrixCoefficients();
+    void setMatrixCoefficients(std::vector<double>& all_mat_vals);
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(HYPRE_SStructVector vector,
@@ -331,6 +346,20 @@ private:
     int d_skip_relax;
     int d_two_norm;
     //\}
+
+    /*!
+     * \name Data used to determine whether the hypre data structures and solver
+     * setup may be reused by initializeSolverState().
+     *
+     * \note d_cached_matrix_coefs is a full copy of the matrix coefficients of
+     * the level.  It is retained between solves only when reuse is enabled.
+     */
+    //\{
+    bool d_reuse_hypre_setup;
+    bool d_hypre_data_cached;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_patch_boxes;
+    std::vector<double> d_cached_matrix_coefs;
+    //\}
 };
 } // namespace IBTK
 
@@ -100,6 +100,10 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ smoother_fused_sweeps = 1                    // number of sweeps per ghost cell fill for
+                                              // "TILED_RED_BLACK_GAUSS_SEIDEL"
+ smoother_tile_size = 16                      // number of rows per tile for
+                                              // "TILED_RED_BLACK_GAUSS_SEIDEL"
  prolongation_method = "CONSTANT_REFINE"      // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
@@ -150,6 +154,13 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "TILED_RED_BLACK_GAUSS_SEIDEL"
+     *
+     * The tiled red-black smoother performs the red and black half sweeps of
+     * up to \c smoother_fused_sweeps consecutive sweeps together on each
+     * patch, using the cache-blocked kernels provided by class
+     * PoissonSmoothers.  Ghost cell values are refilled only between groups
+     * of fused sweeps.
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -263,6 +274,11 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Parameters for the tiled red-black Gauss-Seidel smoother.
+     */
+    int d_smoother_fused_sweeps, d_smoother_tile_size;
+
     /*
      * Patch overlap data.
      */
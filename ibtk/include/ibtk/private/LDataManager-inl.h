@@ -240,6 +240,28 @@ LDataManager::getLagrangianStructureIndexRange(const int structure_id, const int
     return cit->second;
 } // getLagrangianStructureIndexRange
 
+inline const std::vector<int>&
+LDataManager::getLocalLagrangianStructureIDs(const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    return d_local_strct_ids[level_number];
+} // getLocalLagrangianStructureIDs
+
+inline const std::vector<int>&
+LDataManager::getLocalLagrangianStructureNodeIndices(const int structure_id, const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    static const std::vector<int> empty_idxs;
+    std::map<int, std::vector<int> >::const_iterator cit =
+        d_strct_id_to_local_petsc_idxs_map[level_number].find(structure_id);
+    if (UNLIKELY(cit == d_strct_id_to_local_petsc_idxs_map[level_number].end())) return empty_idxs;
+    return cit->second;
+} // getLocalLagrangianStructureNodeIndices
+
 inline bool
 LDataManager::getLagrangianStructureIsActivated(const int structure_id, const int level_number) const
 {
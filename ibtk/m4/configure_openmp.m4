@@ -0,0 +1,43 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable threading of patch loops with OpenMP @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  AC_MSG_CHECKING([for C++ compiler flag to enable OpenMP])
+  OPENMP_CXXFLAGS=unknown
+  OPENMP_save_CXXFLAGS=$CXXFLAGS
+  for openmp_flag in "" -fopenmp -qopenmp -openmp ; do
+    CXXFLAGS="$openmp_flag $OPENMP_save_CXXFLAGS"
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#ifndef _OPENMP
+#error OpenMP is not enabled
+#endif
+#include <omp.h>
+]], [[
+    return omp_get_max_threads() > 0 ? 0 : 1;
+]])],[OPENMP_CXXFLAGS=$openmp_flag])
+    if test "$OPENMP_CXXFLAGS" != unknown ; then
+      break
+    fi
+  done
+  CXXFLAGS=$OPENMP_save_CXXFLAGS
+  if test "$OPENMP_CXXFLAGS" = unknown ; then
+    AC_MSG_RESULT([unknown])
+    AC_MSG_ERROR([could not determine how to enable OpenMP with the C++ compiler])
+  fi
+  if test x"$OPENMP_CXXFLAGS" = x ; then
+    AC_MSG_RESULT([none needed])
+  else
+    AC_MSG_RESULT([$OPENMP_CXXFLAGS])
+  fi
+  CXXFLAGS_PREPEND($OPENMP_CXXFLAGS)
+  LDFLAGS_PREPEND($OPENMP_CXXFLAGS)
+fi
+])
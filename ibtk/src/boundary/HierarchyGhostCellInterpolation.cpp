@@ -34,10 +34,12 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <list>
 #include <ostream>
 #include <string>
 #include <vector>
 
+#include "BoxGeometryFillPattern.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -106,6 +108,12 @@ static Timer* t_fill_data;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+
+// The maximum number of inactive collections of communication schedules to
+// keep, and the number of recently requested collections of transaction
+// components that are used to detect recurring components.
+static const unsigned int SCHEDULE_CACHE_SIZE = 4;
+static const unsigned int RECENT_TRANSACTION_COMPS_SIZE = 2 * SCHEDULE_CACHE_SIZE;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -127,7 +135,11 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
       d_cf_bdry_ops(),
       d_extrap_bc_ops(),
       d_cc_robin_bc_ops(),
-      d_sc_robin_bc_ops()
+      d_sc_robin_bc_ops(),
+      d_schedule_cache(),
+      d_recent_transaction_comps(),
+      d_schedule_cache_hits(0),
+      d_schedule_cache_misses(0)
 {
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -204,152 +216,9 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
     IBTK_DO_ONCE(d_grid_geom->addSpatialCoarsenOperator(new CartCellDoubleCubicCoarsen());
                  d_grid_geom->addSpatialCoarsenOperator(new CartSideDoubleCubicCoarsen()););
 
-    // Setup cached coarsen algorithms and schedules.
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    bool registered_coarsen_op = false;
-    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
-    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
-    {
-        const std::string& coarsen_op_name = d_transaction_comps[comp_idx].d_coarsen_op_name;
-        if (coarsen_op_name != "NONE")
-        {
-            const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
-            Pointer<Variable<NDIM> > var;
-            var_db->mapIndexToVariable(src_data_idx, var);
-#if !defined(NDEBUG)
-            TBOX_ASSERT(var);
-#endif
-            Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
-#if !defined(NDEBUG)
-            TBOX_ASSERT(coarsen_op);
-#endif
-            d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
-            registered_coarsen_op = true;
-        }
-    }
-
-    d_coarsen_strategy = NULL;
-
-    d_coarsen_scheds.resize(d_finest_ln + 1);
-    if (registered_coarsen_op)
-    {
-        for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(src_ln);
-            Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(src_ln - 1);
-            d_coarsen_scheds[src_ln] = d_coarsen_alg->createSchedule(coarser_level, level, d_coarsen_strategy);
-        }
-    }
-
-    // Setup cached refine algorithms and schedules.
-    d_cf_bdry_ops.resize(d_transaction_comps.size());
-    d_extrap_bc_ops.resize(d_transaction_comps.size());
-    d_cc_robin_bc_ops.resize(d_transaction_comps.size());
-    d_sc_robin_bc_ops.resize(d_transaction_comps.size());
-    d_refine_alg = new RefineAlgorithm<NDIM>();
-    std::vector<RefinePatchStrategy<NDIM>*> refine_patch_strategies;
-    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
-    {
-        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
-        const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
-        Pointer<Variable<NDIM> > var;
-        var_db->mapIndexToVariable(src_data_idx, var);
-        Pointer<CellVariable<NDIM, double> > cc_var = var;
-        Pointer<NodeVariable<NDIM, double> > nc_var = var;
-        Pointer<SideVariable<NDIM, double> > sc_var = var;
-        Pointer<RefineOperator<NDIM> > refine_op = NULL;
-        d_cf_bdry_ops[comp_idx] = NULL;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
-        if (cc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
-            {
-                d_cf_bdry_ops[comp_idx] = new CartCellDoubleQuadraticCFInterpolation();
-                d_cf_bdry_ops[comp_idx]->setConsistentInterpolationScheme(
-                    d_transaction_comps[comp_idx].d_consistent_type_2_bdry);
-                d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
-                d_cf_bdry_ops[comp_idx]->setPatchHierarchy(d_hierarchy);
-                refine_patch_strategies.push_back(d_cf_bdry_ops[comp_idx]);
-            }
-        }
-        else if (nc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
-            {
-                TBOX_ERROR("not supported yet.\n");
-            }
-        }
-        else if (sc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
-            {
-                d_cf_bdry_ops[comp_idx] = new CartSideDoubleQuadraticCFInterpolation();
-                d_cf_bdry_ops[comp_idx]->setConsistentInterpolationScheme(
-                    d_transaction_comps[comp_idx].d_consistent_type_2_bdry);
-                d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
-                d_cf_bdry_ops[comp_idx]->setPatchHierarchy(d_hierarchy);
-                refine_patch_strategies.push_back(d_cf_bdry_ops[comp_idx]);
-            }
-        }
-        else
-        {
-            TBOX_ERROR("HierarchyGhostCellInterpolation::initializeOperatorState():\n"
-                       << "  only double-precision cell-, node-, or side-centered data is "
-                          "presently supported."
-                       << std::endl);
-        }
-
-        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
-
-        const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
-        if (phys_bdry_extrap_type != "NONE")
-        {
-            d_extrap_bc_ops[comp_idx] = new CartExtrapPhysBdryOp(dst_data_idx, phys_bdry_extrap_type);
-            refine_patch_strategies.push_back(d_extrap_bc_ops[comp_idx]);
-        }
-
-        const std::vector<RobinBcCoefStrategy<NDIM>*>& robin_bc_coefs = d_transaction_comps[comp_idx].d_robin_bc_coefs;
-        bool null_bc_coefs = true;
-        for (std::vector<RobinBcCoefStrategy<NDIM>*>::const_iterator cit = robin_bc_coefs.begin();
-             cit != robin_bc_coefs.end();
-             ++cit)
-        {
-            if (*cit) null_bc_coefs = false;
-        }
-        if (!null_bc_coefs && cc_var)
-        {
-            d_cc_robin_bc_ops[comp_idx] = new CartCellRobinPhysBdryOp(dst_data_idx, robin_bc_coefs, d_homogeneous_bc);
-        }
-        if (!null_bc_coefs && sc_var)
-        {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(robin_bc_coefs.size() == NDIM);
-#endif
-            d_sc_robin_bc_ops[comp_idx] = new CartSideRobinPhysBdryOp(dst_data_idx, robin_bc_coefs, d_homogeneous_bc);
-        }
-    }
-
-    d_refine_strategy =
-        new RefinePatchStrategySet(refine_patch_strategies.begin(), refine_patch_strategies.end(), false);
-
-    d_refine_scheds.resize(d_finest_ln + 1);
-    for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
-        d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
-    }
+    // Setup cached communications algorithms, schedules, and boundary
+    // condition handlers.
+    createOperatorState();
 
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
@@ -397,6 +266,57 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
                       "interpolation transaction components.\n");
     }
 
+    // Nothing needs to be done if the components are not actually changed.
+    if (equivalentTransactionComponents(d_transaction_comps, transaction_comps))
+    {
+        ++d_schedule_cache_hits;
+        IBTK_TIMER_STOP(t_reset_transaction_components);
+        return;
+    }
+
+    // Reuse cached schedules if they are available.
+    for (std::list<ScheduleCacheEntry>::iterator it = d_schedule_cache.begin(); it != d_schedule_cache.end(); ++it)
+    {
+        if (equivalentTransactionComponents(it->d_transaction_comps, transaction_comps))
+        {
+            ++d_schedule_cache_hits;
+            swapOperatorState(*it);
+            d_schedule_cache.splice(d_schedule_cache.begin(), d_schedule_cache, it);
+            IBTK_TIMER_STOP(t_reset_transaction_components);
+            return;
+        }
+    }
+    ++d_schedule_cache_misses;
+
+    // Keep track of the recently requested components.  If the components
+    // have been requested recently, the currently used schedules are retained
+    // in the cache and new schedules are created for the components.
+    // Otherwise, the currently used schedules are reset below.
+    bool recurring_transaction_comps = false;
+    for (std::list<std::vector<InterpolationTransactionComponent> >::const_iterator cit =
+             d_recent_transaction_comps.begin();
+         cit != d_recent_transaction_comps.end() && !recurring_transaction_comps;
+         ++cit)
+    {
+        recurring_transaction_comps = equivalentTransactionComponents(*cit, transaction_comps);
+    }
+    d_recent_transaction_comps.push_front(transaction_comps);
+    if (d_recent_transaction_comps.size() > RECENT_TRANSACTION_COMPS_SIZE) d_recent_transaction_comps.pop_back();
+    if (recurring_transaction_comps)
+    {
+        d_schedule_cache.push_front(ScheduleCacheEntry());
+        swapOperatorState(d_schedule_cache.front());
+        d_transaction_comps = transaction_comps;
+        createOperatorState();
+        if (d_schedule_cache.size() > SCHEDULE_CACHE_SIZE)
+        {
+            deallocateScheduleCacheEntry(d_schedule_cache.back());
+            d_schedule_cache.pop_back();
+        }
+        IBTK_TIMER_STOP(t_reset_transaction_components);
+        return;
+    }
+
     // Reset the transaction components.
     d_transaction_comps = transaction_comps;
 
@@ -570,6 +490,14 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_strategy = NULL;
     d_refine_scheds.clear();
 
+    // Clear the schedule cache.
+    for (std::list<ScheduleCacheEntry>::iterator it = d_schedule_cache.begin(); it != d_schedule_cache.end(); ++it)
+    {
+        deallocateScheduleCacheEntry(*it);
+    }
+    d_schedule_cache.clear();
+    d_recent_transaction_comps.clear();
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
 
@@ -663,10 +591,259 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     return;
 } // fillData
 
+int
+HierarchyGhostCellInterpolation::getNumberOfScheduleCacheHits() const
+{
+    return d_schedule_cache_hits;
+} // getNumberOfScheduleCacheHits
+
+int
+HierarchyGhostCellInterpolation::getNumberOfScheduleCacheMisses() const
+{
+    return d_schedule_cache_misses;
+} // getNumberOfScheduleCacheMisses
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+HierarchyGhostCellInterpolation::ScheduleCacheEntry::ScheduleCacheEntry()
+    : d_transaction_comps(),
+      d_coarsen_alg(NULL),
+      d_coarsen_strategy(NULL),
+      d_coarsen_scheds(),
+      d_refine_alg(NULL),
+      d_refine_strategy(NULL),
+      d_refine_scheds(),
+      d_cf_bdry_ops(),
+      d_extrap_bc_ops(),
+      d_cc_robin_bc_ops(),
+      d_sc_robin_bc_ops()
+{
+    // intentionally blank
+    return;
+} // ScheduleCacheEntry
+
+void
+HierarchyGhostCellInterpolation::createOperatorState()
+{
+    // Setup cached coarsen algorithms and schedules.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    bool registered_coarsen_op = false;
+    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        const std::string& coarsen_op_name = d_transaction_comps[comp_idx].d_coarsen_op_name;
+        if (coarsen_op_name != "NONE")
+        {
+            const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
+            Pointer<Variable<NDIM> > var;
+            var_db->mapIndexToVariable(src_data_idx, var);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(var);
+#endif
+            Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(coarsen_op);
+#endif
+            d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
+            registered_coarsen_op = true;
+        }
+    }
+
+    d_coarsen_strategy = NULL;
+
+    d_coarsen_scheds.resize(d_finest_ln + 1);
+    if (registered_coarsen_op)
+    {
+        for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(src_ln);
+            Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(src_ln - 1);
+            d_coarsen_scheds[src_ln] = d_coarsen_alg->createSchedule(coarser_level, level, d_coarsen_strategy);
+        }
+    }
+
+    // Setup cached refine algorithms and schedules.
+    d_cf_bdry_ops.resize(d_transaction_comps.size());
+    d_extrap_bc_ops.resize(d_transaction_comps.size());
+    d_cc_robin_bc_ops.resize(d_transaction_comps.size());
+    d_sc_robin_bc_ops.resize(d_transaction_comps.size());
+    d_refine_alg = new RefineAlgorithm<NDIM>();
+    std::vector<RefinePatchStrategy<NDIM>*> refine_patch_strategies;
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+        const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(src_data_idx, var);
+        Pointer<CellVariable<NDIM, double> > cc_var = var;
+        Pointer<NodeVariable<NDIM, double> > nc_var = var;
+        Pointer<SideVariable<NDIM, double> > sc_var = var;
+        Pointer<RefineOperator<NDIM> > refine_op = NULL;
+        d_cf_bdry_ops[comp_idx] = NULL;
+        Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
+        if (cc_var)
+        {
+            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            {
+                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+            }
+            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
+            {
+                d_cf_bdry_ops[comp_idx] = new CartCellDoubleQuadraticCFInterpolation();
+                d_cf_bdry_ops[comp_idx]->setConsistentInterpolationScheme(
+                    d_transaction_comps[comp_idx].d_consistent_type_2_bdry);
+                d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
+                d_cf_bdry_ops[comp_idx]->setPatchHierarchy(d_hierarchy);
+                refine_patch_strategies.push_back(d_cf_bdry_ops[comp_idx]);
+            }
+        }
+        else if (nc_var)
+        {
+            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            {
+                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+            }
+            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
+            {
+                TBOX_ERROR("not supported yet.\n");
+            }
+        }
+        else if (sc_var)
+        {
+            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+            {
+                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+            }
+            if (d_transaction_comps[comp_idx].d_use_cf_bdry_interpolation)
+            {
+                d_cf_bdry_ops[comp_idx] = new CartSideDoubleQuadraticCFInterpolation();
+                d_cf_bdry_ops[comp_idx]->setConsistentInterpolationScheme(
+                    d_transaction_comps[comp_idx].d_consistent_type_2_bdry);
+                d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
+                d_cf_bdry_ops[comp_idx]->setPatchHierarchy(d_hierarchy);
+                refine_patch_strategies.push_back(d_cf_bdry_ops[comp_idx]);
+            }
+        }
+        else
+        {
+            TBOX_ERROR("HierarchyGhostCellInterpolation::initializeOperatorState():\n"
+                       << "  only double-precision cell-, node-, or side-centered data is "
+                          "presently supported."
+                       << std::endl);
+        }
+
+        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
+
+        const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
+        if (phys_bdry_extrap_type != "NONE")
+        {
+            d_extrap_bc_ops[comp_idx] = new CartExtrapPhysBdryOp(dst_data_idx, phys_bdry_extrap_type);
+            refine_patch_strategies.push_back(d_extrap_bc_ops[comp_idx]);
+        }
+
+        const std::vector<RobinBcCoefStrategy<NDIM>*>& robin_bc_coefs = d_transaction_comps[comp_idx].d_robin_bc_coefs;
+        bool null_bc_coefs = true;
+        for (std::vector<RobinBcCoefStrategy<NDIM>*>::const_iterator cit = robin_bc_coefs.begin();
+             cit != robin_bc_coefs.end();
+             ++cit)
+        {
+            if (*cit) null_bc_coefs = false;
+        }
+        if (!null_bc_coefs && cc_var)
+        {
+            d_cc_robin_bc_ops[comp_idx] = new CartCellRobinPhysBdryOp(dst_data_idx, robin_bc_coefs, d_homogeneous_bc);
+        }
+        if (!null_bc_coefs && sc_var)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(robin_bc_coefs.size() == NDIM);
+#endif
+            d_sc_robin_bc_ops[comp_idx] = new CartSideRobinPhysBdryOp(dst_data_idx, robin_bc_coefs, d_homogeneous_bc);
+        }
+    }
+
+    d_refine_strategy =
+        new RefinePatchStrategySet(refine_patch_strategies.begin(), refine_patch_strategies.end(), false);
+
+    d_refine_scheds.resize(d_finest_ln + 1);
+    for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+        d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
+    }
+    return;
+} // createOperatorState
+
+void
+HierarchyGhostCellInterpolation::swapOperatorState(ScheduleCacheEntry& entry)
+{
+    d_transaction_comps.swap(entry.d_transaction_comps);
+    std::swap(d_coarsen_alg, entry.d_coarsen_alg);
+    std::swap(d_coarsen_strategy, entry.d_coarsen_strategy);
+    d_coarsen_scheds.swap(entry.d_coarsen_scheds);
+    std::swap(d_refine_alg, entry.d_refine_alg);
+    std::swap(d_refine_strategy, entry.d_refine_strategy);
+    d_refine_scheds.swap(entry.d_refine_scheds);
+    d_cf_bdry_ops.swap(entry.d_cf_bdry_ops);
+    d_extrap_bc_ops.swap(entry.d_extrap_bc_ops);
+    d_cc_robin_bc_ops.swap(entry.d_cc_robin_bc_ops);
+    d_sc_robin_bc_ops.swap(entry.d_sc_robin_bc_ops);
+    return;
+} // swapOperatorState
+
+void
+HierarchyGhostCellInterpolation::deallocateScheduleCacheEntry(ScheduleCacheEntry& entry)
+{
+    entry.d_cf_bdry_ops.clear();
+    entry.d_extrap_bc_ops.clear();
+    entry.d_cc_robin_bc_ops.clear();
+    entry.d_sc_robin_bc_ops.clear();
+    entry.d_coarsen_alg.setNull();
+    delete entry.d_coarsen_strategy;
+    entry.d_coarsen_strategy = NULL;
+    entry.d_coarsen_scheds.clear();
+    entry.d_refine_alg.setNull();
+    delete entry.d_refine_strategy;
+    entry.d_refine_strategy = NULL;
+    entry.d_refine_scheds.clear();
+    return;
+} // deallocateScheduleCacheEntry
+
+bool
+HierarchyGhostCellInterpolation::equivalentTransactionComponents(
+    const std::vector<InterpolationTransactionComponent>& comps1,
+    const std::vector<InterpolationTransactionComponent>& comps2)
+{
+    if (comps1.size() != comps2.size()) return false;
+    for (unsigned int comp_idx = 0; comp_idx < comps1.size(); ++comp_idx)
+    {
+        const InterpolationTransactionComponent& comp1 = comps1[comp_idx];
+        const InterpolationTransactionComponent& comp2 = comps2[comp_idx];
+        if (comp1.d_dst_data_idx != comp2.d_dst_data_idx || comp1.d_src_data_idx != comp2.d_src_data_idx ||
+            comp1.d_refine_op_name != comp2.d_refine_op_name ||
+            comp1.d_use_cf_bdry_interpolation != comp2.d_use_cf_bdry_interpolation ||
+            comp1.d_coarsen_op_name != comp2.d_coarsen_op_name ||
+            comp1.d_phys_bdry_extrap_type != comp2.d_phys_bdry_extrap_type ||
+            comp1.d_consistent_type_2_bdry != comp2.d_consistent_type_2_bdry ||
+            comp1.d_robin_bc_coefs != comp2.d_robin_bc_coefs)
+        {
+            return false;
+        }
+
+        // Default fill patterns are created anew for each transaction
+        // component, but all such patterns are equivalent.
+        if (comp1.d_fill_pattern != comp2.d_fill_pattern)
+        {
+            Pointer<BoxGeometryFillPattern<NDIM> > box_fill_pattern1 = comp1.d_fill_pattern;
+            Pointer<BoxGeometryFillPattern<NDIM> > box_fill_pattern2 = comp2.d_fill_pattern;
+            if (box_fill_pattern1.isNull() || box_fill_pattern2.isNull()) return false;
+        }
+    }
+    return true;
+} // equivalentTransactionComponents
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
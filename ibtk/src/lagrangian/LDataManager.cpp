@@ -290,6 +290,8 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_local_strct_ids.resize(d_finest_ln + 1);
+    d_strct_id_to_local_petsc_idxs_map.resize(d_finest_ln + 1);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
@@ -928,27 +930,18 @@ LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, con
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
 #endif
-    int node_counter = 0;
     Point X_com(Point::Zero());
-    std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(structure_id, level_number);
+    const std::vector<int>& strct_local_idxs = getLocalLagrangianStructureNodeIndices(structure_id, level_number);
+    int node_counter = static_cast<int>(strct_local_idxs.size());
 
     const boost::multi_array_ref<double, 2>& X_data =
         *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getLocalFormVecArray();
-    const Pointer<LMesh> mesh = getLMesh(level_number);
-    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    for (std::vector<int>::const_iterator cit = strct_local_idxs.begin(); cit != strct_local_idxs.end(); ++cit)
     {
-        const LNode* const node_idx = *cit;
-        const int lag_idx = node_idx->getLagrangianIndex();
-        if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+        const double* const X = &X_data[*cit][0];
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            ++node_counter;
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data[local_idx][0];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_com[d] += X[d];
-            }
+            X_com[d] += X[d];
         }
     }
     d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
@@ -970,25 +963,17 @@ LDataManager::computeLagrangianStructureBoundingBox(const int structure_id, cons
 #endif
     Point X_lower(Point::Constant(std::numeric_limits<double>::max()));
     Point X_upper(Point::Constant(-std::numeric_limits<double>::max()));
-    std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(structure_id, level_number);
+    const std::vector<int>& strct_local_idxs = getLocalLagrangianStructureNodeIndices(structure_id, level_number);
 
     const boost::multi_array_ref<double, 2>& X_data =
         *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getLocalFormVecArray();
-    const Pointer<LMesh> mesh = getLMesh(level_number);
-    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    for (std::vector<int>::const_iterator cit = strct_local_idxs.begin(); cit != strct_local_idxs.end(); ++cit)
     {
-        const LNode* const node_idx = *cit;
-        const int lag_idx = node_idx->getLagrangianIndex();
-        if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+        const double* const X = &X_data[*cit][0];
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data[local_idx][0];
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_lower[d] = std::min(X_lower[d], X[d]);
-                X_upper[d] = std::max(X_upper[d], X[d]);
-            }
+            X_lower[d] = std::min(X_lower[d], X[d]);
+            X_upper[d] = std::max(X_upper[d], X[d]);
         }
     }
     d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
@@ -1778,6 +1763,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         num_local_nodes[level_number] = static_cast<int>(d_local_lag_indices[level_number].size());
         num_nonlocal_nodes[level_number] = static_cast<int>(d_nonlocal_lag_indices[level_number].size());
 
+        // Update the structure IDs associated with the local nodes.
+        computeLocalStructureIndexing(level_number);
+
         // Setup src indices.
         std::vector<int> src_inds(num_local_nodes[level_number]);
         for (int k = 0; k < num_local_nodes[level_number]; ++k)
@@ -1987,10 +1975,18 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    ++d_num_data_redistributions;
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
 
+unsigned int
+LDataManager::getNumberOfDataRedistributions() const
+{
+    return d_num_data_redistributions;
+} // getNumberOfDataRedistributions
+
 void
 LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2158,6 +2154,8 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+        d_local_strct_ids.resize(d_finest_ln + 1);
+        d_strct_id_to_local_petsc_idxs_map.resize(d_finest_ln + 1);
         d_lag_mesh.resize(level_number + 1);
         d_lag_mesh_data.resize(level_number + 1);
         d_needs_synch.resize(level_number + 1, false);
@@ -2321,6 +2319,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
                 }
             }
         }
+        computeLocalStructureIndexing(level_number);
         const unsigned int num_initialized_global_nodes =
             static_cast<unsigned int>(SAMRAI_MPI::sumReduction(static_cast<int>(local_nodes.size())));
         if (num_initialized_global_nodes != d_num_nodes[level_number])
@@ -2684,6 +2683,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_scratch_context(NULL),
       d_current_data(),
       d_scratch_data(),
+      d_num_data_redistributions(0),
       d_lag_mesh(),
       d_lag_mesh_data(),
       d_needs_synch(true),
@@ -3121,6 +3121,49 @@ LDataManager::computeNodeDistribution(AO& ao,
     return;
 } // computeNodeDistribution
 
+void
+LDataManager::computeLocalStructureIndexing(const int level_number)
+{
+    const std::vector<int>& local_lag_indices = d_local_lag_indices[level_number];
+    const std::map<int, int>& last_lag_idx_to_strct_id_map = d_last_lag_idx_to_strct_id_map[level_number];
+    std::vector<int>& local_strct_ids = d_local_strct_ids[level_number];
+    std::map<int, std::vector<int> >& strct_id_to_local_petsc_idxs_map =
+        d_strct_id_to_local_petsc_idxs_map[level_number];
+    const int num_local_nodes = static_cast<int>(local_lag_indices.size());
+    local_strct_ids.resize(num_local_nodes);
+    strct_id_to_local_petsc_idxs_map.clear();
+
+    // Since nodes of a structure tend to be stored contiguously, cache the
+    // most recently used structure index range to avoid repeated map lookups.
+    int strct_id = -1;
+    std::pair<int, int> strct_idx_range(0, 0);
+    std::vector<int>* strct_local_idxs = NULL;
+    for (int local_idx = 0; local_idx < num_local_nodes; ++local_idx)
+    {
+        const int lag_idx = local_lag_indices[local_idx];
+        if (!(strct_idx_range.first <= lag_idx && lag_idx < strct_idx_range.second))
+        {
+            strct_id = -1;
+            strct_idx_range = std::make_pair(0, 0);
+            strct_local_idxs = NULL;
+            std::map<int, int>::const_iterator cit = last_lag_idx_to_strct_id_map.lower_bound(lag_idx);
+            if (cit != last_lag_idx_to_strct_id_map.end())
+            {
+                const std::pair<int, int>& idx_range = d_strct_id_to_lag_idx_range_map[level_number][cit->second];
+                if (idx_range.first <= lag_idx && lag_idx < idx_range.second)
+                {
+                    strct_id = cit->second;
+                    strct_idx_range = idx_range;
+                    strct_local_idxs = &strct_id_to_local_petsc_idxs_map[strct_id];
+                }
+            }
+        }
+        local_strct_ids[local_idx] = strct_id;
+        if (strct_local_idxs) strct_local_idxs->push_back(local_idx);
+    }
+    return;
+} // computeLocalStructureIndexing
+
 void
 LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, const unsigned int num_local_nodes)
 {
@@ -3178,6 +3221,8 @@ LDataManager::getFromRestart()
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_posns.resize(d_finest_ln + 1);
+    d_local_strct_ids.resize(d_finest_ln + 1);
+    d_strct_id_to_local_petsc_idxs_map.resize(d_finest_ln + 1);
     d_lag_mesh.resize(d_finest_ln + 1);
     d_lag_mesh_data.resize(d_finest_ln + 1);
     d_needs_synch.resize(d_finest_ln + 1, false);
@@ -3292,6 +3337,9 @@ LDataManager::getFromRestart()
                 "d_nonlocal_petsc_indices", &d_nonlocal_petsc_indices[level_number][0], n_nonlocal_petsc_indices);
         }
 
+        // Rebuild the structure IDs associated with the local nodes.
+        computeLocalStructureIndexing(level_number);
+
         // Rebuild the application ordering.
         int ierr;
         ierr = AOCreateMapping(PETSC_COMM_WORLD,
@@ -92,6 +92,7 @@
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/ParallelPatchFor.h"
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -439,9 +440,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -477,9 +479,10 @@ HierarchyMathOps::curl(const int dst_idx,
             {
                 Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                const ParallelPatchFor patch_for(level);
+                IBTK_PARALLEL_PATCH_FOR(k, patch_for)
                 {
-                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
                     Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
                     Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(d_sc_idx);
@@ -623,9 +626,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -651,9 +655,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -679,9 +684,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -707,9 +713,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -740,9 +747,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -773,9 +781,10 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -815,7 +824,9 @@ HierarchyMathOps::rot(int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        // Compute the discrete rot.
+        // Compute the discrete rot.  The patches are processed serially
+        // because the patch operator allocates temporary patch data and
+        // shares the boundary condition object between patches.
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -858,7 +869,9 @@ HierarchyMathOps::rot(int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        // Compute the discrete rot.
+        // Compute the discrete rot.  The patches are processed serially
+        // because the patch operator allocates temporary patch data and
+        // shares the boundary condition object between patches.
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -901,7 +914,9 @@ HierarchyMathOps::rot(int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        // Compute the discrete rot.
+        // Compute the discrete rot.  The patches are processed serially
+        // because the patch operator allocates temporary patch data and
+        // shares the boundary condition object between patches.
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -939,7 +954,9 @@ HierarchyMathOps::rot(int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        // Compute the discrete rot.
+        // Compute the discrete rot.  The patches are processed serially
+        // because the patch operator allocates temporary patch data and
+        // shares the boundary condition object between patches.
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -975,9 +992,10 @@ HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1055,9 +1073,10 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1113,9 +1132,10 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1163,9 +1183,10 @@ HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1276,9 +1297,10 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1335,9 +1357,10 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1569,9 +1592,10 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1666,9 +1690,10 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -1756,9 +1781,10 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1804,9 +1830,10 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1852,9 +1879,10 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1903,9 +1931,10 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -1994,9 +2023,10 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2228,9 +2258,10 @@ HierarchyMathOps::laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2317,9 +2348,10 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef_data = patch->getPatchData(coef_idx);
@@ -2383,9 +2415,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2418,9 +2451,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2464,9 +2498,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2508,9 +2543,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2543,9 +2579,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2589,9 +2626,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2633,9 +2671,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2668,9 +2707,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2714,9 +2754,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2758,9 +2799,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2793,9 +2835,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2839,9 +2882,10 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
@@ -2876,9 +2920,10 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2899,9 +2944,10 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2922,9 +2968,10 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2945,9 +2992,10 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2968,9 +3016,10 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -2991,9 +3040,10 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
@@ -3004,6 +3054,33 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     return;
 } // pointwiseMaxNorm
 
+void
+HierarchyMathOps::synchronizeCoarseFineInterface(const int data_idx,
+                                                 const Pointer<SideVariable<NDIM, double> > /*data_var*/,
+                                                 const int ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ln > d_coarsest_ln && ln <= d_finest_ln);
+#endif
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    level->allocatePatchData(d_os_idx);
+
+    // Extract data on the coarse-fine interface.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+        os_data->copy(*data);
+    }
+
+    // Synchronize the coarse-fine interface and deallocate temporary data.
+    xeqScheduleOutersideRestriction(data_idx, d_os_idx, ln - 1);
+    level->deallocatePatchData(d_os_idx);
+    return;
+} // synchronizeCoarseFineInterface
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -149,7 +149,11 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
       d_rap_type(RAP_TYPE_GALERKIN),
       d_relax_type(RELAX_TYPE_WEIGHTED_JACOBI),
       d_skip_relax(1),
-      d_two_norm(1)
+      d_two_norm(1),
+      d_reuse_hypre_setup(false),
+      d_hypre_data_cached(false),
+      d_cached_patch_boxes(),
+      d_cached_matrix_coefs()
 {
     if (NDIM == 1 || NDIM > 3)
     {
@@ -177,6 +181,8 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_setup"))
+            d_reuse_hypre_setup = input_db->getBool("reuse_hypre_setup");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -219,6 +225,12 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_cached)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+        d_hypre_data_cached = false;
+    }
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -331,45 +343,86 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
-    // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-    TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
-    d_level = d_hierarchy->getPatchLevel(d_level_num);
-    if (d_level_num > 0)
-    {
-        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
-    }
-
-    // Allocate and initialize the hypre data structures.
+    // Determine the structure of the new problem.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int level_num = x.getCoarsestLevelNumber();
+    TBOX_ASSERT(level_num == x.getFinestLevelNumber());
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patch_boxes.push_back(level->getPatch(p())->getBox());
+    }
+
+    // Determine whether the cached hypre data structures, if any, are
+    // compatible with the new problem.  This decision must be made
+    // consistently on all processes because hypre setup is collective.
+    bool reuse_hypre_data = false;
+    if (d_hypre_data_cached)
+    {
+        int layout_unchanged = (d_reuse_hypre_setup && hierarchy == d_hierarchy && level_num == d_level_num &&
+                                depth == d_depth && grid_aligned_anisotropy == d_grid_aligned_anisotropy &&
+                                patch_boxes == d_cached_patch_boxes) ?
+                                   1 :
+                                   0;
+        reuse_hypre_data = SAMRAI_MPI::minReduction(layout_unchanged) == 1;
+        if (!reuse_hypre_data)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+            d_hypre_data_cached = false;
+        }
+    }
+
+    // Get the hierarchy information.
+    d_hierarchy = hierarchy;
+    d_level_num = level_num;
+    d_level = level;
+    if (d_level_num > 0)
+    {
+        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
-    allocateHypreData();
+    d_depth = depth;
+    d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+    d_cached_patch_boxes = patch_boxes;
+
+    // Allocate (if needed) and initialize the hypre data structures.  When the
+    // hypre data are reused, the solver setup is redone only if the matrix
+    // coefficients have changed.
+    if (!reuse_hypre_data) allocateHypreData();
+    std::vector<double> matrix_coefs;
     if (d_grid_aligned_anisotropy)
     {
-        setMatrixCoefficients_aligned();
+        setMatrixCoefficients_aligned(matrix_coefs);
     }
     else
     {
-        setMatrixCoefficients_nonaligned();
+        setMatrixCoefficients_nonaligned(matrix_coefs);
     }
-    setupHypreSolver();
+    int matrix_coefs_changed = (!reuse_hypre_data || matrix_coefs != d_cached_matrix_coefs) ? 1 : 0;
+    if (reuse_hypre_data) matrix_coefs_changed = SAMRAI_MPI::maxReduction(matrix_coefs_changed);
+    if (matrix_coefs_changed)
+    {
+        assembleHypreMatrices();
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+    }
+    d_cached_matrix_coefs.swap(matrix_coefs);
+    d_hypre_data_cached = true;
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -385,9 +438,17 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures and the cached copy of the matrix
+    // coefficients, unless they are to be retained for use by a subsequent call
+    // to initializeSolverState().
+    if (!d_reuse_hypre_setup)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+        d_hypre_data_cached = false;
+        std::vector<Box<NDIM> >().swap(d_cached_patch_boxes);
+        std::vector<double>().swap(d_cached_matrix_coefs);
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -524,8 +585,9 @@ CCPoissonHypreLevelSolver::allocateHypreData()
 } // allocateHypreData
 
 void
-CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
+CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned(std::vector<double>& all_mat_vals)
 {
+    all_mat_vals.clear();
     // Set matrix entries and copy them to the hypre matrix structures.
     const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
     std::vector<int> stencil_indices(stencil_sz);
@@ -550,22 +612,18 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
                 {
                     mat_vals[j] = matrix_coefs(i, j);
                 }
+                all_mat_vals.insert(all_mat_vals.end(), mat_vals.begin(), mat_vals.end());
                 HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, &stencil_indices[0], &mat_vals[0]);
             }
         }
     }
-
-    // Assemble the hypre matrices.
-    for (unsigned int k = 0; k < d_depth; ++k)
-    {
-        HYPRE_StructMatrixAssemble(d_matrices[k]);
-    }
     return;
 } // setMatrixCoefficients_aligned
 
 void
-CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
+CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned(std::vector<double>& all_mat_vals)
 {
+    all_mat_vals.clear();
     static const IntVector<NDIM> no_ghosts = 0;
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
@@ -756,20 +814,25 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
                 }
             }
 
+            all_mat_vals.insert(all_mat_vals.end(), mat_vals.begin(), mat_vals.end());
             for (unsigned int k = 0; k < d_depth; ++k)
             {
                 HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, stencil_indices, &mat_vals[0]);
             }
         }
     }
+    return;
+} // setMatrixCoefficients_nonaligned
 
-    // Assemble the hypre matrices.
+void
+CCPoissonHypreLevelSolver::assembleHypreMatrices()
+{
     for (unsigned int k = 0; k < d_depth; ++k)
     {
         HYPRE_StructMatrixAssemble(d_matrices[k]);
     }
     return;
-} // setMatrixCoefficients_nonaligned
+} // assembleHypreMatrices
 
 void
 CCPoissonHypreLevelSolver::setupHypreSolver()
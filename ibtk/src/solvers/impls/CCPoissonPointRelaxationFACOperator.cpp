@@ -81,6 +81,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
+#include "ibtk/PoissonSmoothers.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
@@ -198,6 +199,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    TILED_RED_BLACK_GAUSS_SEIDEL,
     UNKNOWN = -1
 };
 
@@ -206,8 +208,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "TILED_RED_BLACK_GAUSS_SEIDEL")
+        return TILED_RED_BLACK_GAUSS_SEIDEL;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -225,10 +228,24 @@ use_red_black_ordering(SmootherType smoother_type)
     }
 } // use_red_black_ordering
 
+inline bool
+use_tiled_smoother(SmootherType smoother_type)
+{
+    if (smoother_type == TILED_RED_BLACK_GAUSS_SEIDEL)
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_tiled_smoother
+
 inline bool
 do_local_data_update(SmootherType smoother_type)
 {
-    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL ||
+        smoother_type == TILED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -252,6 +269,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
           default_options_prefix),
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
+      d_smoother_fused_sweeps(1),
+      d_smoother_tile_size(PoissonSmoothers::DEFAULT_TILE_SIZE),
       d_patch_bc_box_overlap(),
       d_patch_neighbor_overlap()
 {
@@ -272,6 +291,9 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("smoother_fused_sweeps"))
+            d_smoother_fused_sweeps = input_db->getInteger("smoother_fused_sweeps");
+        if (input_db->keyExists("smoother_tile_size")) d_smoother_tile_size = input_db->getInteger("smoother_tile_size");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -379,6 +401,7 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     TBOX_ASSERT(smoother_type != UNKNOWN);
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
+    const bool tiled_smoother = use_tiled_smoother(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
@@ -402,8 +425,12 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     }
 
     // Smooth the error by the specified number of sweeps.
-    if (red_black_ordering) num_sweeps *= 2;
-    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    //
+    // NOTE: The tiled smoother performs several half sweeps on each patch
+    // between ghost cell fills.
+    if (red_black_ordering || tiled_smoother) num_sweeps *= 2;
+    const int num_fused_half_sweeps = tiled_smoother ? 2 * std::max(d_smoother_fused_sweeps, 1) : 1;
+    for (int isweep = 0; isweep < num_sweeps; isweep += num_fused_half_sweeps)
     {
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
@@ -498,7 +525,21 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 const int U_ghosts = (error_data->getGhostCellWidth()).max();
                 const double* const F = residual_data->getPointer(depth);
                 const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                if (red_black_ordering)
+                if (tiled_smoother)
+                {
+                    PoissonSmoothers::redBlackGaussSeidelSmooth(error_data->getArrayData(),
+                                                                residual_data->getArrayData(),
+                                                                NULL,
+                                                                depth,
+                                                                patch_box,
+                                                                dx,
+                                                                alpha,
+                                                                beta,
+                                                                isweep % 2,
+                                                                std::min(num_fused_half_sweeps, num_sweeps - isweep),
+                                                                d_smoother_tile_size);
+                }
+                else if (red_black_ordering)
                 {
                     int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                     RB_GS_SMOOTH_FC(U,
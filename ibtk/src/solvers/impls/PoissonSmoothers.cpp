@@ -0,0 +1,258 @@
+// Filename: PoissonSmoothers.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "ibtk/PoissonSmoothers.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Number of cells of a single color that are updated together through the
+// packed buffer.
+static const int CHUNK_SIZE = 64;
+
+// Addressing information for one array in the ghost box of the patch data.
+struct ArrayLayout
+{
+    ArrayLayout(const Box<NDIM>& array_box, const Box<NDIM>& box) : stride(), offset(0)
+    {
+        stride[0] = 1;
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            stride[d] = stride[d - 1] * array_box.numberCells(d - 1);
+        }
+        offset = box.lower(0) - array_box.lower(0);
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            offset -= array_box.lower(d) * stride[d];
+        }
+        return;
+    } // ArrayLayout
+
+    // Offset of the first cell of row (j,k) of the box relative to the start
+    // of the array.
+    inline int rowOffset(const int j, const int k) const
+    {
+#if (NDIM == 2)
+        NULL_USE(k);
+        return offset + j * stride[1];
+#endif
+#if (NDIM == 3)
+        return offset + j * stride[1] + k * stride[2];
+#endif
+    } // rowOffset
+
+    int stride[NDIM];
+    int offset;
+};
+
+// Update the cells of one color in a single row of the patch.
+inline void
+smooth_row(double* const U,
+           const int U_stride_1,
+           const int U_stride_2,
+           const double* const F,
+           const int* const mask,
+           const int i_start,
+           const int n,
+           const double fac0,
+           const double fac1,
+           const double fac2,
+           const double fac)
+{
+    double U_new[CHUNK_SIZE];
+    for (int i_chunk = i_start; i_chunk < n; i_chunk += 2 * CHUNK_SIZE)
+    {
+        const int m = std::min(CHUNK_SIZE, (n - i_chunk + 1) / 2);
+        const double* const U_c = U + i_chunk;
+        const double* const F_c = F + i_chunk;
+        for (int l = 0; l < m; ++l)
+        {
+            const int i = 2 * l;
+            U_new[l] = fac * (fac0 * (U_c[i - 1] + U_c[i + 1]) + fac1 * (U_c[i - U_stride_1] + U_c[i + U_stride_1]) +
+                              fac2 * (U_c[i - U_stride_2] + U_c[i + U_stride_2]) - F_c[i]);
+        }
+        double* const U_w = U + i_chunk;
+        if (mask)
+        {
+            const int* const mask_c = mask + i_chunk;
+            for (int l = 0; l < m; ++l)
+            {
+                if (mask_c[2 * l] == 0) U_w[2 * l] = U_new[l];
+            }
+        }
+        else
+        {
+            for (int l = 0; l < m; ++l)
+            {
+                U_w[2 * l] = U_new[l];
+            }
+        }
+    }
+    return;
+} // smooth_row
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+PoissonSmoothers::redBlackGaussSeidelSmooth(ArrayData<NDIM, double>& U_data,
+                                            const ArrayData<NDIM, double>& F_data,
+                                            const ArrayData<NDIM, int>* const mask_data,
+                                            const int depth,
+                                            const Box<NDIM>& box,
+                                            const double* const dx,
+                                            const double alpha,
+                                            const double beta,
+                                            const int first_color,
+                                            const int num_half_sweeps,
+                                            const int tile_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getBox().contains(Box<NDIM>::grow(box, 1)));
+    TBOX_ASSERT(F_data.getBox().contains(box));
+    TBOX_ASSERT(!mask_data || mask_data->getBox().contains(box));
+    TBOX_ASSERT(tile_size > 0);
+#endif
+    if (num_half_sweeps <= 0 || box.empty()) return;
+
+    const ArrayLayout U_layout(U_data.getBox(), box);
+    const ArrayLayout F_layout(F_data.getBox(), box);
+    const ArrayLayout mask_layout(mask_data ? mask_data->getBox() : box, box);
+    double* const U = U_data.getPointer(depth);
+    const double* const F = F_data.getPointer(depth);
+    const int* const mask = mask_data ? mask_data->getPointer(depth) : NULL;
+
+    const double fac0 = alpha / (dx[0] * dx[0]);
+    const double fac1 = alpha / (dx[1] * dx[1]);
+#if (NDIM == 2)
+    const double fac2 = 0.0;
+    const int U_stride_2 = 0;
+    const double fac = 0.5 / (fac0 + fac1 - 0.5 * beta);
+#endif
+#if (NDIM == 3)
+    const double fac2 = alpha / (dx[2] * dx[2]);
+    const int U_stride_2 = U_layout.stride[2];
+    const double fac = 0.5 / (fac0 + fac1 + fac2 - 0.5 * beta);
+#endif
+    const int U_stride_1 = U_layout.stride[1];
+    const int ilower = box.lower(0);
+    const int n = box.numberCells(0);
+
+    // The half sweeps are pipelined along the last coordinate direction:
+    // half sweep m updates plane p after half sweep m-1 has updated planes
+    // p-1, p, and p+1.  In three spatial dimensions, each half sweep
+    // processes the rows of a tile shifted down by one row relative to the
+    // preceding half sweep, so that the tiles respect the same dependencies.
+    const int plane_axis = NDIM - 1;
+    const int plane_lower = box.lower(plane_axis);
+    const int plane_upper = box.upper(plane_axis);
+    const int num_planes = plane_upper - plane_lower + 1;
+#if (NDIM == 2)
+    const int num_tiles = 1;
+    NULL_USE(tile_size);
+#endif
+#if (NDIM == 3)
+    const int row_lower = box.lower(1), row_upper = box.upper(1), tile = tile_size;
+    const int num_tiles = (row_upper - row_lower + num_half_sweeps + tile - 1) / tile;
+#endif
+    for (int tile_num = 0; tile_num < num_tiles; ++tile_num)
+    {
+#if (NDIM == 3)
+        const int tile_lower = row_lower + tile_num * tile;
+#endif
+        for (int t = 0; t < num_planes + num_half_sweeps - 1; ++t)
+        {
+            for (int m = 0; m < num_half_sweeps; ++m)
+            {
+                const int p = plane_lower + t - m;
+                if (p < plane_lower || p > plane_upper) continue;
+                const int color = (first_color + m) & 1;
+#if (NDIM == 2)
+                const int j = p, k = 0;
+                const int i_start = (color - ilower - j) & 1;
+                smooth_row(U + U_layout.rowOffset(j, k),
+                           U_stride_1,
+                           U_stride_2,
+                           F + F_layout.rowOffset(j, k),
+                           mask ? mask + mask_layout.rowOffset(j, k) : NULL,
+                           i_start,
+                           n,
+                           fac0,
+                           fac1,
+                           fac2,
+                           fac);
+#endif
+#if (NDIM == 3)
+                const int k = p;
+                const int j_begin = std::max(row_lower, tile_lower - m);
+                const int j_end = std::min(row_upper + 1, tile_lower - m + tile);
+                for (int j = j_begin; j < j_end; ++j)
+                {
+                    const int i_start = (color - ilower - j - k) & 1;
+                    smooth_row(U + U_layout.rowOffset(j, k),
+                               U_stride_1,
+                               U_stride_2,
+                               F + F_layout.rowOffset(j, k),
+                               mask ? mask + mask_layout.rowOffset(j, k) : NULL,
+                               i_start,
+                               n,
+                               fac0,
+                               fac1,
+                               fac2,
+                               fac);
+                }
+#endif
+            }
+        }
+    }
+    return;
+} // redBlackGaussSeidelSmooth
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -113,7 +113,11 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
       d_num_post_relax_steps(1),
       d_relax_type(RELAX_TYPE_WEIGHTED_JACOBI),
       d_skip_relax(1),
-      d_two_norm(1)
+      d_two_norm(1),
+      d_reuse_hypre_setup(false),
+      d_hypre_data_cached(false),
+      d_cached_patch_boxes(),
+      d_cached_matrix_coefs()
 {
     if (NDIM == 1 || NDIM > 3)
     {
@@ -141,6 +145,8 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_setup"))
+            d_reuse_hypre_setup = input_db->getBool("reuse_hypre_setup");
 
         if (d_solver_type == "SysPFMG" || d_precond_type == "SysPFMG")
         {
@@ -179,6 +185,12 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_cached)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+        d_hypre_data_cached = false;
+    }
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -293,20 +305,62 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
+    // Determine the structure of the new problem.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int level_num = x.getCoarsestLevelNumber();
+    TBOX_ASSERT(level_num == x.getFinestLevelNumber());
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patch_boxes.push_back(level->getPatch(p())->getBox());
+    }
+
+    // Determine whether the cached hypre data structures, if any, are
+    // compatible with the new problem.  This decision must be made
+    // consistently on all processes because hypre setup is collective.
+    bool reuse_hypre_data = false;
+    if (d_hypre_data_cached)
+    {
+        int layout_unchanged = (d_reuse_hypre_setup && hierarchy == d_hierarchy && level_num == d_level_num &&
+                                patch_boxes == d_cached_patch_boxes) ?
+                                   1 :
+                                   0;
+        reuse_hypre_data = SAMRAI_MPI::minReduction(layout_unchanged) == 1;
+        if (!reuse_hypre_data)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+            d_hypre_data_cached = false;
+        }
+    }
+
     // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-    TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
-    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    d_hierarchy = hierarchy;
+    d_level_num = level_num;
+    d_level = level;
     if (d_level_num > 0)
     {
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
-
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
-    setMatrixCoefficients();
-    setupHypreSolver();
+    d_cached_patch_boxes = patch_boxes;
+
+    // Allocate (if needed) and initialize the hypre data structures.  When the
+    // hypre data are reused, the solver setup is redone only if the matrix
+    // coefficients have changed.
+    if (!reuse_hypre_data) allocateHypreData();
+    std::vector<double> matrix_coefs;
+    setMatrixCoefficients(matrix_coefs);
+    int matrix_coefs_changed = (!reuse_hypre_data || matrix_coefs != d_cached_matrix_coefs) ? 1 : 0;
+    if (reuse_hypre_data) matrix_coefs_changed = SAMRAI_MPI::maxReduction(matrix_coefs_changed);
+    if (matrix_coefs_changed)
+    {
+        HYPRE_SStructMatrixAssemble(d_matrix);
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+    }
+    d_cached_matrix_coefs.swap(matrix_coefs);
+    d_hypre_data_cached = true;
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -322,9 +376,17 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures and the cached copy of the matrix
+    // coefficients, unless they are to be retained for use by a subsequent call
+    // to initializeSolverState().
+    if (!d_reuse_hypre_setup)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+        d_hypre_data_cached = false;
+        std::vector<Box<NDIM> >().swap(d_cached_patch_boxes);
+        std::vector<double>().swap(d_cached_matrix_coefs);
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -422,8 +484,9 @@ SCPoissonHypreLevelSolver::allocateHypreData()
 } // allocateHypreData
 
 void
-SCPoissonHypreLevelSolver::setMatrixCoefficients()
+SCPoissonHypreLevelSolver::setMatrixCoefficients(std::vector<double>& all_mat_vals)
 {
+    all_mat_vals.clear();
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -450,6 +513,7 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
                 {
                     mat_vals[k] = matrix_coefs(i, k);
                 }
+                all_mat_vals.insert(all_mat_vals.end(), mat_vals.begin(), mat_vals.end());
                 // NOTE: In SAMRAI, face-centered values are associated with the
                 // cell index located on the "upper" side of the face, but in
                 // hypre, face-centered values are associated with the cell
@@ -460,8 +524,6 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
         }
     }
 
-    // Assemble the hypre matrix.
-    HYPRE_SStructMatrixAssemble(d_matrix);
     return;
 } // setMatrixCoefficients
 
@@ -74,6 +74,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
+#include "ibtk/PoissonSmoothers.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SCPoissonPointRelaxationFACOperator.h"
@@ -217,6 +218,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    TILED_RED_BLACK_GAUSS_SEIDEL,
     UNKNOWN = -1
 };
 
@@ -225,8 +227,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "TILED_RED_BLACK_GAUSS_SEIDEL")
+        return TILED_RED_BLACK_GAUSS_SEIDEL;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -244,10 +247,24 @@ use_red_black_ordering(SmootherType smoother_type)
     }
 } // use_red_black_ordering
 
+inline bool
+use_tiled_smoother(SmootherType smoother_type)
+{
+    if (smoother_type == TILED_RED_BLACK_GAUSS_SEIDEL)
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_tiled_smoother
+
 inline bool
 do_local_data_update(SmootherType smoother_type)
 {
-    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL ||
+        smoother_type == TILED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -271,6 +288,8 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
           default_options_prefix),
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
+      d_smoother_fused_sweeps(1),
+      d_smoother_tile_size(PoissonSmoothers::DEFAULT_TILE_SIZE),
       d_patch_bc_box_overlap(),
       d_patch_neighbor_overlap()
 {
@@ -290,6 +309,9 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("smoother_fused_sweeps"))
+            d_smoother_fused_sweeps = input_db->getInteger("smoother_fused_sweeps");
+        if (input_db->keyExists("smoother_tile_size")) d_smoother_tile_size = input_db->getInteger("smoother_tile_size");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -406,6 +428,7 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     TBOX_ASSERT(smoother_type != UNKNOWN);
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
+    const bool tiled_smoother = use_tiled_smoother(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
@@ -433,8 +456,12 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     }
 
     // Smooth the error by the specified number of sweeps.
-    if (red_black_ordering) num_sweeps *= 2;
-    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    //
+    // NOTE: The tiled smoother performs several half sweeps on each patch
+    // between ghost cell fills.
+    if (red_black_ordering || tiled_smoother) num_sweeps *= 2;
+    const int num_fused_half_sweeps = tiled_smoother ? 2 * std::max(d_smoother_fused_sweeps, 1) : 1;
+    for (int isweep = 0; isweep < num_sweeps; isweep += num_fused_half_sweeps)
     {
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
@@ -544,7 +571,24 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int F_ghosts = (residual_data->getGhostCellWidth()).max();
                     const int* const mask = mask_data->getPointer(axis, depth);
                     const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
-                    if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
+                    if (tiled_smoother)
+                    {
+                        const bool use_mask =
+                            patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis);
+                        PoissonSmoothers::redBlackGaussSeidelSmooth(
+                            error_data->getArrayData(axis),
+                            residual_data->getArrayData(axis),
+                            use_mask ? &mask_data->getArrayData(axis) : NULL,
+                            depth,
+                            side_patch_box,
+                            dx,
+                            alpha,
+                            beta,
+                            isweep % 2,
+                            std::min(num_fused_half_sweeps, num_sweeps - isweep),
+                            d_smoother_tile_size);
+                    }
+                    else if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
                     {
                         if (red_black_ordering)
                         {
@@ -34,6 +34,7 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <limits>
 #include <list>
@@ -142,6 +143,16 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_dt_growth_factor = 2.0;
     d_integrator_step = 0;
     d_num_cycles = 1;
+    d_enable_adaptive_time_stepping = false;
+    d_dt_error_tol = 1.0e-3;
+    d_dt_safety_factor = 0.9;
+    d_dt_pi_alpha = 0.35;
+    d_dt_pi_beta = 0.2;
+    d_dt_min_reduction_factor = 0.2;
+    d_max_dt_rejections = 10;
+    d_dt_adaptive = std::numeric_limits<double>::max();
+    d_dt_error_ratio_previous = 1.0;
+    d_num_rejected_time_steps = 0;
     d_max_integrator_steps = std::numeric_limits<int>::max();
     d_regrid_interval = 1;
     d_regrid_mode = STANDARD;
@@ -306,7 +317,7 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         dt = d_end_time - d_integrator_time;
     }
     const double current_time = d_integrator_time;
-    const double new_time = d_integrator_time + dt;
+    double new_time = d_integrator_time + dt;
     if (dt < 0.0)
     {
         TBOX_ERROR(d_object_name << "::advanceHierarchy():\n"
@@ -349,28 +360,65 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         d_at_regrid_time_step = true;
     }
 
-    // Determine the number of cycles and the time step size.
-    d_current_num_cycles = getNumberOfCycles();
-    d_current_dt = new_time - current_time;
+    // Integrate the hierarchy.  When adaptive time stepping is enabled, time
+    // steps with estimated errors that exceed the error tolerance are rejected
+    // and repeated with a reduced time step size.
+    int num_rejected_steps = 0;
+    while (true)
+    {
+        // Determine the number of cycles and the time step size.
+        d_current_num_cycles = getNumberOfCycles();
+        d_current_dt = new_time - current_time;
 
-    // Execute the preprocessing method of the parent integrator, and
-    // recursively execute all preprocessing callbacks registered with the
-    // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+        // Execute the preprocessing method of the parent integrator, and
+        // recursively execute all preprocessing callbacks registered with the
+        // parent and child integrators.
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
 
-    // Perform one or more cycles.  In each cycle, execute the integration
-    // method of the parent integrator, and recursively execute all integration
-    // callbacks registered with the parent and child integrators.
-    if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
-    for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
-    {
-        if (d_enable_logging && d_current_num_cycles != 1)
+        // Perform one or more cycles.  In each cycle, execute the integration
+        // method of the parent integrator, and recursively execute all
+        // integration callbacks registered with the parent and child
+        // integrators.
+        if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
+        for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
         {
-            if (d_enable_logging)
-                plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
-                     << d_current_num_cycles << "\n";
+            if (d_enable_logging && d_current_num_cycles != 1)
+            {
+                if (d_enable_logging)
+                    plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
+                         << d_current_num_cycles << "\n";
+            }
+            integrateHierarchy(current_time, new_time, cycle_num);
         }
-        integrateHierarchy(current_time, new_time, cycle_num);
+        if (!d_enable_adaptive_time_stepping) break;
+
+        // Determine whether to accept the time step.
+        const double error_ratio = getTimeStepErrorEstimate() / d_dt_error_tol;
+        if (d_enable_logging)
+            plog << d_object_name << "::advanceHierarchy(): normalized error estimate = " << error_ratio << "\n";
+        const double dt_min_allowed = getMinimumTimeStepSize();
+        if (error_ratio <= 1.0 || num_rejected_steps >= d_max_dt_rejections || dt <= dt_min_allowed)
+        {
+            if (error_ratio > 1.0)
+            {
+                pout << "WARNING: at time = " << d_integrator_time << ": accepting time step size dt = " << dt
+                     << " with normalized error estimate = " << error_ratio << ".\n";
+            }
+            d_dt_adaptive = dt * computeTimeStepSizeFactor(error_ratio, d_dt_error_ratio_previous, false);
+            d_dt_error_ratio_previous = std::max(error_ratio, 1.0e-4);
+            break;
+        }
+
+        // Reject the time step and reset the integrator to its state at the
+        // beginning of the time step.
+        ++num_rejected_steps;
+        ++d_num_rejected_time_steps;
+        dt = std::max(dt_min_allowed, dt * computeTimeStepSizeFactor(error_ratio, d_dt_error_ratio_previous, true));
+        if (d_enable_logging)
+            plog << d_object_name << "::advanceHierarchy(): rejecting time step, retrying with dt = " << dt << "\n";
+        resetIntegratorToPreadvanceState();
+        resetCurrentTimeStepData();
+        new_time = current_time + dt;
     }
 
     // Execute the postprocessing method of the parent integrator, and
@@ -381,17 +429,7 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
-    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
-    while (!hier_integrators.empty())
-    {
-        HierarchyIntegrator* integrator = hier_integrators.front();
-        integrator->d_current_num_cycles = -1;
-        integrator->d_current_cycle_num = -1;
-        integrator->d_current_dt = std::numeric_limits<double>::quiet_NaN();
-        hier_integrators.pop_front();
-        hier_integrators.insert(
-            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
-    }
+    resetCurrentTimeStepData();
 
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
@@ -430,6 +468,24 @@ HierarchyIntegrator::getMaximumTimeStepSize()
     return std::min(dt, d_end_time - d_integrator_time);
 } // getMaximumTimeStepSize
 
+double
+HierarchyIntegrator::getTimeStepErrorEstimate()
+{
+    double error = getTimeStepErrorEstimateSpecialized();
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin(); it != d_child_integrators.end();
+         ++it)
+    {
+        error = std::max(error, (*it)->getTimeStepErrorEstimate());
+    }
+    return error;
+} // getTimeStepErrorEstimate
+
+int
+HierarchyIntegrator::getNumberOfRejectedTimeSteps() const
+{
+    return d_num_rejected_time_steps;
+} // getNumberOfRejectedTimeSteps
+
 void
 HierarchyIntegrator::synchronizeHierarchyData(VariableContextType ctx_type)
 {
@@ -1050,6 +1106,9 @@ HierarchyIntegrator::putToDatabase(Pointer<Database> db)
     db->putInteger("d_integrator_step", d_integrator_step);
     db->putInteger("d_max_integrator_steps", d_max_integrator_steps);
     db->putInteger("d_num_cycles", d_num_cycles);
+    db->putDouble("d_dt_adaptive", d_dt_adaptive);
+    db->putDouble("d_dt_error_ratio_previous", d_dt_error_ratio_previous);
+    db->putInteger("d_num_rejected_time_steps", d_num_rejected_time_steps);
     db->putInteger("d_regrid_interval", d_regrid_interval);
     db->putString("d_regrid_mode", enum_to_string<RegridMode>(d_regrid_mode));
     db->putBool("d_enable_logging", d_enable_logging);
@@ -1080,9 +1139,24 @@ HierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
     {
         dt = std::min(dt, std::max(1.0, d_dt_growth_factor) * d_dt_previous[0]);
     }
+    if (d_enable_adaptive_time_stepping) dt = std::min(dt, d_dt_adaptive);
     return dt;
 } // getMaximumTimeStepSizeSpecialized
 
+double
+HierarchyIntegrator::getTimeStepErrorEstimateSpecialized()
+{
+    return 0.0;
+} // getTimeStepErrorEstimateSpecialized
+
+bool
+HierarchyIntegrator::usingAdaptiveTimeStepping() const
+{
+    const HierarchyIntegrator* integrator = this;
+    while (integrator->d_parent_integrator) integrator = integrator->d_parent_integrator;
+    return integrator->d_enable_adaptive_time_stepping;
+} // usingAdaptiveTimeStepping
+
 void
 HierarchyIntegrator::synchronizeHierarchyDataSpecialized(VariableContextType ctx_type)
 {
@@ -1583,6 +1657,20 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
         d_dt_growth_factor = db->getDouble("dt_growth_factor");
     if (db->keyExists("max_integrator_steps")) d_max_integrator_steps = db->getInteger("max_integrator_steps");
     if (db->keyExists("num_cycles")) d_num_cycles = db->getInteger("num_cycles");
+    if (db->keyExists("enable_adaptive_time_stepping"))
+        d_enable_adaptive_time_stepping = db->getBool("enable_adaptive_time_stepping");
+    if (db->keyExists("dt_error_tol")) d_dt_error_tol = db->getDouble("dt_error_tol");
+    if (db->keyExists("dt_safety_factor")) d_dt_safety_factor = db->getDouble("dt_safety_factor");
+    if (db->keyExists("dt_pi_alpha")) d_dt_pi_alpha = db->getDouble("dt_pi_alpha");
+    if (db->keyExists("dt_pi_beta")) d_dt_pi_beta = db->getDouble("dt_pi_beta");
+    if (db->keyExists("dt_min_reduction_factor")) d_dt_min_reduction_factor = db->getDouble("dt_min_reduction_factor");
+    if (db->keyExists("max_dt_rejections")) d_max_dt_rejections = db->getInteger("max_dt_rejections");
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_dt_error_tol > 0.0);
+    TBOX_ASSERT(d_dt_safety_factor > 0.0 && d_dt_safety_factor <= 1.0);
+    TBOX_ASSERT(d_dt_min_reduction_factor > 0.0 && d_dt_min_reduction_factor < 1.0);
+    TBOX_ASSERT(d_max_dt_rejections >= 0);
+#endif
     if (db->keyExists("regrid_interval")) d_regrid_interval = db->getInteger("regrid_interval");
     if (db->keyExists("regrid_mode")) d_regrid_mode = string_to_enum<RegridMode>(db->getString("regrid_mode"));
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
@@ -1631,6 +1719,9 @@ HierarchyIntegrator::getFromRestart()
     d_integrator_step = db->getInteger("d_integrator_step");
     d_max_integrator_steps = db->getInteger("d_max_integrator_steps");
     d_num_cycles = db->getInteger("d_num_cycles");
+    d_dt_adaptive = db->getDoubleWithDefault("d_dt_adaptive", std::numeric_limits<double>::max());
+    d_dt_error_ratio_previous = db->getDoubleWithDefault("d_dt_error_ratio_previous", 1.0);
+    d_num_rejected_time_steps = db->getIntegerWithDefault("d_num_rejected_time_steps", 0);
     d_regrid_interval = db->getInteger("d_regrid_interval");
     d_regrid_mode = string_to_enum<RegridMode>(db->getString("d_regrid_mode"));
     d_enable_logging = db->getBool("d_enable_logging");
@@ -1639,6 +1730,48 @@ HierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+HierarchyIntegrator::resetCurrentTimeStepData()
+{
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        integrator->d_current_num_cycles = -1;
+        integrator->d_current_cycle_num = -1;
+        integrator->d_current_dt = std::numeric_limits<double>::quiet_NaN();
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    return;
+} // resetCurrentTimeStepData
+
+double
+HierarchyIntegrator::computeTimeStepSizeFactor(const double error_ratio,
+                                               const double error_ratio_previous,
+                                               const bool step_rejected) const
+{
+    const double dt_max_growth_factor = std::max(1.0, d_dt_growth_factor);
+    if (error_ratio <= 0.0) return dt_max_growth_factor;
+
+    // Following a rejected step, only the current error estimate is used to
+    // determine the reduced time step size.  Otherwise, the PI controller
+    //
+    //    dt_new = safety * dt * (1/r_n)^alpha * r_{n-1}^beta
+    //
+    // is used, in which r_n is the error estimate normalized by the error
+    // tolerance.
+    if (step_rejected)
+    {
+        const double factor = d_dt_safety_factor * std::pow(error_ratio, -d_dt_pi_alpha);
+        return std::max(d_dt_min_reduction_factor, std::min(d_dt_safety_factor, factor));
+    }
+    const double factor =
+        d_dt_safety_factor * std::pow(error_ratio, -d_dt_pi_alpha) * std::pow(error_ratio_previous, d_dt_pi_beta);
+    return std::max(d_dt_min_reduction_factor, std::min(dt_max_growth_factor, factor));
+} // computeTimeStepSizeFactor
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
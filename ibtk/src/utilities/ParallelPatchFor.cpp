@@ -0,0 +1,150 @@
+// Filename: ParallelPatchFor.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Order (size, index) pairs by decreasing size and then by increasing index,
+// so that the ordering of the patches does not depend on the sort algorithm.
+inline bool
+larger_patch_first(const std::pair<int, int>& a, const std::pair<int, int>& b)
+{
+    return (a.first > b.first) || (a.first == b.first && a.second < b.second);
+} // larger_patch_first
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+ParallelPatchFor::ParallelPatchFor(Pointer<PatchLevel<NDIM> > level) : d_patches()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level);
+#endif
+    std::vector<Pointer<Patch<NDIM> > > patches;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patches.push_back(level->getPatch(p()));
+    }
+    if (getMaxNumberOfThreads() == 1)
+    {
+        d_patches.swap(patches);
+        return;
+    }
+
+    // Hand out the largest patches first so that the smaller patches can fill
+    // in the gaps at the end of the loop.
+    const int num_patches = static_cast<int>(patches.size());
+    std::vector<std::pair<int, int> > patch_sizes(num_patches);
+    for (int k = 0; k < num_patches; ++k)
+    {
+        patch_sizes[k] = std::make_pair(patches[k]->getBox().size(), k);
+    }
+    std::sort(patch_sizes.begin(), patch_sizes.end(), larger_patch_first);
+    d_patches.resize(num_patches);
+    for (int k = 0; k < num_patches; ++k)
+    {
+        d_patches[k] = patches[patch_sizes[k].second];
+    }
+    return;
+} // ParallelPatchFor
+
+ParallelPatchFor::~ParallelPatchFor()
+{
+    // intentionally blank
+    return;
+} // ~ParallelPatchFor
+
+int
+ParallelPatchFor::getNumberOfPatches() const
+{
+    return static_cast<int>(d_patches.size());
+} // getNumberOfPatches
+
+const Pointer<Patch<NDIM> >&
+ParallelPatchFor::getPatch(const int k) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= k && k < static_cast<int>(d_patches.size()));
+#endif
+    return d_patches[k];
+} // getPatch
+
+int
+ParallelPatchFor::getMaxNumberOfThreads()
+{
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+} // getMaxNumberOfThreads
+
+int
+ParallelPatchFor::getThreadNumber()
+{
+#if defined(_OPENMP)
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+} // getThreadNumber
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
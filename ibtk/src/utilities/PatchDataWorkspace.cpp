@@ -0,0 +1,266 @@
+// Filename: PatchDataWorkspace.cpp
+//
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <list>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/PatchDataWorkspace.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Arrays are aligned on cache line boundaries relative to the start of the
+// workspace.
+static const size_t ALIGNMENT = 8;
+
+inline size_t
+align(const size_t size)
+{
+    return ALIGNMENT * ((size + ALIGNMENT - 1) / ALIGNMENT);
+} // align
+
+// Number of values in a single depth of the specified component of face- or
+// side-centered data.  Face-centered data permutes the index space so that
+// the normal direction comes first, but the number of values is the same as
+// for side-centered data.
+inline size_t
+component_size(const Box<NDIM>& box, const IntVector<NDIM>& ghosts, const unsigned int axis)
+{
+    size_t size = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        size *= static_cast<size_t>(box.numberCells(d) + 2 * ghosts(d) + (d == axis ? 1 : 0));
+    }
+    return size;
+} // component_size
+
+// Number of values in a single depth of cell-centered data.
+inline size_t
+cell_size(const Box<NDIM>& box, const IntVector<NDIM>& ghosts)
+{
+    size_t size = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        size *= static_cast<size_t>(box.numberCells(d) + 2 * ghosts(d));
+    }
+    return size;
+} // cell_size
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchDataWorkspace::DataView::DataView() : d_ptrs(), d_depth_offsets(), d_ghosts(0), d_depth(0)
+{
+    d_ptrs.fill(NULL);
+    d_depth_offsets.fill(0);
+    return;
+} // DataView
+
+double*
+PatchDataWorkspace::DataView::getPointer(const int axis, const int depth) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= axis && axis < NDIM);
+    TBOX_ASSERT(0 <= depth && depth < d_depth);
+    TBOX_ASSERT(d_ptrs[axis]);
+#endif
+    return d_ptrs[axis] + depth * d_depth_offsets[axis];
+} // getPointer
+
+const IntVector<NDIM>&
+PatchDataWorkspace::DataView::getGhostCellWidth() const
+{
+    return d_ghosts;
+} // getGhostCellWidth
+
+int
+PatchDataWorkspace::DataView::getDepth() const
+{
+    return d_depth;
+} // getDepth
+
+PatchDataWorkspace::PatchDataWorkspace() : d_thread_storage(ParallelPatchFor::getMaxNumberOfThreads())
+{
+    // intentionally blank
+    return;
+} // PatchDataWorkspace
+
+PatchDataWorkspace::~PatchDataWorkspace()
+{
+    // intentionally blank
+    return;
+} // ~PatchDataWorkspace
+
+size_t
+PatchDataWorkspace::getDataSize(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    size_t size = 0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        size += align(depth * component_size(box, ghosts, axis));
+    }
+    return size;
+} // getDataSize
+
+size_t
+PatchDataWorkspace::getCellDataSize(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    return align(depth * cell_size(box, ghosts));
+} // getCellDataSize
+
+void
+PatchDataWorkspace::reserve(const size_t size)
+{
+    const size_t num_threads = ParallelPatchFor::getMaxNumberOfThreads();
+    if (num_threads > d_thread_storage.size()) d_thread_storage.resize(num_threads);
+    for (std::vector<ThreadStorage>::iterator it = d_thread_storage.begin(); it != d_thread_storage.end(); ++it)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(it->d_offset == 0 && it->d_overflow_buffers.empty());
+#endif
+        if (size > it->d_buffer.size()) it->d_buffer.resize(size);
+    }
+    return;
+} // reserve
+
+void
+PatchDataWorkspace::reset()
+{
+    ThreadStorage& storage = getThreadStorage();
+    if (!storage.d_overflow_buffers.empty())
+    {
+        const size_t size = storage.d_offset + storage.d_overflow_size;
+        storage.d_overflow_buffers.clear();
+        storage.d_overflow_size = 0;
+        std::vector<double>(size).swap(storage.d_buffer);
+    }
+    storage.d_offset = 0;
+    return;
+} // reset
+
+void
+PatchDataWorkspace::clear()
+{
+    std::vector<ThreadStorage>(ParallelPatchFor::getMaxNumberOfThreads()).swap(d_thread_storage);
+    return;
+} // clear
+
+PatchDataWorkspace::DataView
+PatchDataWorkspace::getCellData(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    DataView data;
+    data.d_ghosts = ghosts;
+    data.d_depth = depth;
+    data.d_ptrs[0] = allocate(getCellDataSize(box, depth, ghosts));
+    data.d_depth_offsets[0] = cell_size(box, ghosts);
+    return data;
+} // getCellData
+
+PatchDataWorkspace::DataView
+PatchDataWorkspace::getFaceData(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    return getData(box, depth, ghosts);
+} // getFaceData
+
+PatchDataWorkspace::DataView
+PatchDataWorkspace::getSideData(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    return getData(box, depth, ghosts);
+} // getSideData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+PatchDataWorkspace::DataView
+PatchDataWorkspace::getData(const Box<NDIM>& box, const int depth, const IntVector<NDIM>& ghosts)
+{
+    DataView data;
+    data.d_ghosts = ghosts;
+    data.d_depth = depth;
+    double* ptr = allocate(getDataSize(box, depth, ghosts));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const size_t size = component_size(box, ghosts, axis);
+        data.d_ptrs[axis] = ptr;
+        data.d_depth_offsets[axis] = size;
+        ptr += align(depth * size);
+    }
+    return data;
+} // getData
+
+double*
+PatchDataWorkspace::allocate(const size_t size)
+{
+    ThreadStorage& storage = getThreadStorage();
+    if (storage.d_offset + size <= storage.d_buffer.size())
+    {
+        double* const ptr = &storage.d_buffer[0] + storage.d_offset;
+        storage.d_offset += size;
+        return ptr;
+    }
+    storage.d_overflow_buffers.push_back(std::vector<double>(size));
+    storage.d_overflow_size += size;
+    return &storage.d_overflow_buffers.back()[0];
+} // allocate
+
+PatchDataWorkspace::ThreadStorage&
+PatchDataWorkspace::getThreadStorage()
+{
+    const int thread = ParallelPatchFor::getThreadNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(thread < static_cast<int>(d_thread_storage.size()));
+#endif
+    return d_thread_storage[thread];
+} // getThreadStorage
+
+PatchDataWorkspace::ThreadStorage::ThreadStorage() : d_buffer(), d_offset(0), d_overflow_buffers(), d_overflow_size(0)
+{
+    // intentionally blank
+    return;
+} // ThreadStorage
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
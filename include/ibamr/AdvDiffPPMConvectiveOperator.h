@@ -197,6 +197,11 @@ private:
      */
     AdvDiffPPMConvectiveOperator& operator=(const AdvDiffPPMConvectiveOperator& that);
 
+    /*!
+     * \brief Allocate any scratch data that are not already allocated.
+     */
+    void allocateScratchData();
+
     // Data communication algorithms, operators, and schedules.
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
@@ -38,6 +38,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
@@ -52,6 +53,10 @@ namespace IBAMR
 {
 class ConvectiveOperator;
 } // namespace IBAMR
+namespace IBTK
+{
+class PoissonSolver;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
@@ -71,6 +76,11 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -94,6 +104,27 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input database sets \p batch_helmholtz_solves to \p TRUE,
+ * consecutively registered transported quantities with constant diffusion
+ * coefficients that share the same diffusion time stepping type, diffusion
+ * coefficient, and damping coefficient are grouped together, and the linear
+ * systems for all of the quantities in each group are solved simultaneously as
+ * a single multi-depth cell-centered system.  The boundary conditions for the
+ * different quantities need not be the same.  Solving the systems together
+ * means that each solver iteration requires only one ghost cell fill and one
+ * set of global reductions for all of the quantities in the group.
+ *
+ * Each group is solved at the position of its last member in the order in
+ * which the quantities were registered, and only the first member of a group
+ * may have a source term, so that the order of the solves relative to the
+ * source term evaluations is the same as for individual solves.  Because the
+ * solver convergence tolerances apply to the combined system, a group is solved
+ * together only when the L2 norms of the right-hand sides of its members differ
+ * by at most a factor of \p batch_helmholtz_max_rhs_norm_ratio (default 10),
+ * and the relative tolerance of the combined solve is reduced so that it
+ * implies the requested relative tolerance for each member.  Otherwise, the
+ * members of the group are solved individually.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -394,6 +425,56 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Group transported quantities whose Helmholtz systems may be solved
+     * simultaneously and register the variables used by the grouped solves.
+     */
+    void setupHelmholtzSolveBatches();
+
+    /*!
+     * Determine whether the quantities in a group of transported quantities
+     * presently share the same Helmholtz problem specification.
+     */
+    bool isHelmholtzSolveBatchActive(unsigned int batch_num);
+
+    /*!
+     * Solve the Helmholtz systems for a group of transported quantities, either
+     * together or, if the scales of the right-hand sides of the members differ
+     * too much, individually.
+     */
+    void solveHelmholtzSolveBatch(unsigned int batch_num,
+                                  const std::vector<TimeSteppingType>& convective_time_stepping_types);
+
+    /*!
+     * Copy data between the components of the transported quantities in a
+     * group and the components of the corresponding grouped quantity.
+     */
+    void copyToHelmholtzSolveBatch(unsigned int batch_num, int batch_idx, bool use_rhs_data);
+    void copyFromHelmholtzSolveBatch(unsigned int batch_num, int batch_idx);
+
+    /*!
+     * Update the new value of a transported quantity following the solution of
+     * its Helmholtz system, and reset the right-hand side.
+     */
+    void completeHelmholtzSolve(unsigned int l,
+                                TimeSteppingType convective_time_stepping_type,
+                                SAMRAI::tbox::Pointer<IBTK::PoissonSolver> helmholtz_solver);
+
+    /*!
+     * Data for solving the Helmholtz systems of several transported quantities
+     * simultaneously.
+     */
+    bool d_batch_helmholtz_solves;
+    double d_batch_helmholtz_max_rhs_norm_ratio;
+    std::vector<int> d_Q_helmholtz_batch;
+    std::vector<std::vector<unsigned int> > d_helmholtz_batches;
+    std::vector<bool> d_helmholtz_batch_active;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > d_batch_sol_var, d_batch_rhs_var;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_batch_sol_vecs,
+        d_batch_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_batch_helmholtz_solvers;
+    std::vector<bool> d_batch_helmholtz_solvers_need_init;
 };
 } // namespace IBAMR
 
@@ -201,6 +201,12 @@ public:
      */
     virtual void postprocessIntegrateData(double current_time, double new_time, int num_cycles);
 
+    /*!
+     * \brief Method to discard the data set up by preprocessIntegrateData() so
+     * that the time step can be repeated.
+     */
+    virtual void resetIntegrateData(double current_time, double new_time, int num_cycles);
+
     /*!
      * \brief Indicate whether L2-projection is to be performed for velocity
      * interpolation.
@@ -235,6 +241,12 @@ public:
      */
     virtual void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * \brief Multirate time stepping is not supported by class CIBFEMethod; this
+     * method emits an unrecoverable exception.
+     */
+    virtual void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * \brief Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -284,6 +284,12 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * \brief Multirate time stepping is not supported by class CIBMethod; this
+     * method emits an unrecoverable exception.
+     */
+    void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * \brief Register VisIt data writer to output data files that
      * may be postprocessed with the VisIt visualization tool.
@@ -149,6 +149,12 @@ public:
      */
     virtual void midpointStep(double current_time, double new_time);
 
+    /*!
+     * \brief Multirate time stepping is not supported by class ConstraintIBMethod; this
+     * method emits an unrecoverable exception.
+     */
+    virtual void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * \brief Override the putToDatabase method of the base Serializable class.
      */
@@ -216,6 +222,13 @@ private:
      */
     void setInitialLagrangianVelocity();
 
+    /*!
+     * \brief Determine the structures to which the local Lagrangian nodes
+     * belong, if the Lagrangian data have been redistributed since the last
+     * call.
+     */
+    void updateLocalNodeStructureHandles();
+
     /*!
      * \brief Calculate center of mass and moment of inertia of immersed
      * structures.
@@ -228,10 +241,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of the self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -404,6 +418,15 @@ private:
      */
     std::vector<std::vector<double> > d_tagged_pt_position;
 
+    /*!
+     * Position in d_ib_kinematics of the structure of each local node, in the
+     * order of IBTK::LMesh::getLocalNodes(), on each level, and the number of
+     * data redistributions for which they were determined.  Nodes that do not
+     * belong to any structure have a position of -1.
+     */
+    std::vector<std::vector<int> > d_local_node_struct_handles;
+    unsigned int d_local_node_struct_handles_redistribution_count;
+
     /*!
      * Density and viscosity of the fluid.
      */
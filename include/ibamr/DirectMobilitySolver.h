@@ -65,6 +65,18 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * Mobility matrices are either recomputed and refactorized at every time step
+ * from the current configuration of the structures, or they are formed and
+ * factorized once in the body frame of reference and applied to the current
+ * configuration through rotations.  The latter is exact for matrices that
+ * describe a single rigid structure, because the self-mobility of a rigid
+ * body is invariant under rigid motions.  If the input option
+ * <TT>recompute_mob_mat_perstep</TT> is <TT>FALSE</TT>, all matrices are
+ * treated in the body frame.  Otherwise, when the input option
+ * <TT>reuse_body_frame_mob_mat</TT> is <TT>TRUE</TT>, only those matrices
+ * that couple multiple structures or that depend on the time step size are
+ * recomputed.  Matrices read from file are always treated in the body frame.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -231,17 +243,17 @@ private:
     /*!
      * \brief Factorize mobility matrix using direct solvers.
      */
-    void factorizeMobilityMatrix();
+    void factorizeMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Construct body mobility matrix as N = K^T inv(M) K.
      */
-    void constructBodyMobilityMatrix();
+    void constructBodyMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Factorize body mobility matrix using direct solvers.
      */
-    void factorizeBodyMobilityMatrix();
+    void factorizeBodyMobilityMatrix(const std::string& mat_name);
 
     /*!
      * \brief Factorize dense matrix.
@@ -255,8 +267,11 @@ private:
 
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * The right-hand side array stores \a num_rhs column-major right-hand side
+     * vectors, which are solved for simultaneously.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs, int num_rhs = 1);
 
     // Solver stuff
     std::string d_object_name;
@@ -278,6 +293,8 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<int*, int*> > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, bool> d_mat_body_frame_map;         // whether the matrix is formed in the body frame
+    std::map<std::string, bool> d_mat_factorized_map;         // whether the factorization is available
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -290,7 +307,7 @@ private:
 
     // Parameters used in this class.
     double d_f_periodic_corr;
-    bool d_recompute_mob_mat;
+    bool d_recompute_mob_mat, d_reuse_body_frame_mob_mat;
     double d_svd_replace_value, d_svd_eps;
 
 }; // DirectMobilitySolver
@@ -70,6 +70,15 @@ namespace IBAMR
 /*!
  * \brief Class IBExplicitHierarchyIntegrator is an implementation of a formally
  * second-order accurate, semi-implicit version of the immersed boundary method.
+ *
+ * When the input key num_structure_substeps is greater than one, the
+ * integrator uses a multirate scheme in which the structure is advanced with
+ * num_structure_substeps explicit substeps per fluid time step (see
+ * IBStrategy::multirateStep()), and only the time-averaged Lagrangian force is
+ * spread to the Cartesian grid.  In the first cycle of each time step, the
+ * structure moves with the velocity at the beginning of the time step; in
+ * subsequent cycles, it moves with a velocity that is linearly interpolated in
+ * time.
  */
 class IBExplicitHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -125,6 +134,12 @@ public:
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
 protected:
+    /*!
+     * Reset the integrator to the state at the beginning of the current time
+     * step.
+     */
+    void resetIntegratorToPreadvanceStateSpecialized();
+
     /*!
      * Write out specialized object state to the given database.
      */
@@ -163,6 +178,11 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*
+     * The number of structure substeps to perform per fluid time step.
+     */
+    int d_num_structure_substeps;
 };
 } // namespace IBAMR
 
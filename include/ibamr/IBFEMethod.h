@@ -186,8 +186,27 @@ public:
      */
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function.
+     *
+     * The function is called once per element with the deformation gradients
+     * FF, the current positions X, and the reference positions s at all of the
+     * quadrature points of the element stored contiguously.  The function must
+     * set PP[qp] for each quadrature point.  PP is sized by the caller.
+     */
+    typedef void (*PK1StressBatchFcnPtr)(std::vector<libMesh::TensorValue<double> >& PP,
+                                         const std::vector<libMesh::TensorValue<double> >& FF,
+                                         const std::vector<libMesh::Point>& X,
+                                         const std::vector<libMesh::Point>& s,
+                                         libMesh::Elem* elem,
+                                         const std::vector<libMesh::NumericVector<double>*>& system_data,
+                                         double data_time,
+                                         void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * \note At most one of fcn and batch_fcn should be non-NULL.
      */
     struct PK1StressFcnData
     {
@@ -196,11 +215,21 @@ public:
                          void* ctx = NULL,
                          libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
                          libMesh::Order quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn), batch_fcn(NULL), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+        {
+        }
+
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         const std::vector<unsigned int>& systems = std::vector<unsigned int>(),
+                         void* ctx = NULL,
+                         libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
+                         libMesh::Order quad_order = libMesh::INVALID_ORDER)
+            : fcn(NULL), batch_fcn(batch_fcn), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
         {
         }
 
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn;
         std::vector<unsigned int> systems;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -223,6 +252,23 @@ public:
                                    libMesh::Order quad_order = libMesh::INVALID_ORDER,
                                    unsigned int part = 0);
 
+    /*!
+     * Register the (optional) batched function to compute the first
+     * Piola-Kirchhoff stress tensor, used to compute the forces on the
+     * Lagrangian finite element mesh.
+     *
+     * \note The batched function is evaluated once per element for all
+     * quadrature points of the element's interior quadrature rule, which allows
+     * the constitutive law to be vectorized.  Boundary quadrature points are
+     * evaluated one at a time.
+     */
+    void registerPK1StressFunction(PK1StressBatchFcnPtr batch_fcn,
+                                   const std::vector<unsigned int>& systems = std::vector<unsigned int>(),
+                                   void* ctx = NULL,
+                                   libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
+                                   libMesh::Order quad_order = libMesh::INVALID_ORDER,
+                                   unsigned int part = 0);
+
     /*!
      * Register the (optional) function to compute the first Piola-Kirchhoff
      * stress tensor, used to compute the forces on the Lagrangian finite
@@ -388,6 +434,12 @@ public:
      */
     void postprocessIntegrateData(double current_time, double new_time, int num_cycles);
 
+    /*!
+     * Method to discard the data set up by preprocessIntegrateData() so that
+     * the time step can be repeated.
+     */
+    void resetIntegrateData(double current_time, double new_time, int num_cycles);
+
     /*!
      * Interpolate the Eulerian velocity to the curvilinear mesh at the
      * specified time within the current time interval.
@@ -416,6 +468,12 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * Advance the positions of the Lagrangian structure using num_substeps
+     * explicit substeps, and compute the time-averaged Lagrangian force.
+     */
+    void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
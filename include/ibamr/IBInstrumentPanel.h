@@ -35,12 +35,12 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
-#include <functional>
 #include <iosfwd>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "boost/multi_array.hpp"
@@ -239,45 +239,43 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Sparse interpolation stencils that map Cartesian grid data to the
+     * meter values.
+     *
+     * Each web patch and web centroid is assigned to precisely one cell of one
+     * patch.  The stencils are set up by initializeHierarchyDependentData() for
+     * each local patch so that readInstrumentData() only needs to form weighted
+     * sums of the grid values.  The depth of each element is the data depth
+     * for cell-centered data and the axis for side-centered data.
      */
-    struct IndexFortranOrder : public std::binary_function<SAMRAI::hier::Index<NDIM>, SAMRAI::hier::Index<NDIM>, bool>
+    struct StencilElement
     {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    ||
-                    (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-                        );
-        } // operator()
+        int meter_num;
+        int depth;
+        SAMRAI::hier::Index<NDIM> i;
+        double wgt;
     };
 
-    struct WebPatch
+    struct PatchStencils
     {
-        int meter_num;
-        const IBTK::Vector* X;
-        const IBTK::Vector* dA;
+        std::vector<StencilElement> U_cc_flow, U_sc_flow, P_mean, P_point;
     };
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder> WebPatchMap;
-    std::vector<WebPatchMap> d_web_patch_map;
+    std::vector<std::map<int, PatchStencils> > d_patch_stencils;
 
-    struct WebCentroid
-    {
-        int meter_num;
-        const IBTK::Vector* X;
-    };
+    /*!
+     * \brief The positions of the perimeter nodes and the boxes and processor
+     * assignments of the patches of each level for which the stencils were set
+     * up.  The stencils are reused while these are unchanged.
+     */
+    std::vector<double> d_stencil_X_perimeter;
+    std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > d_stencil_level_boxes;
+    std::vector<std::vector<int> > d_stencil_level_procs;
 
-    typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder> WebCentroidMap;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    /*!
+     * \brief The total area of the web patches of each meter.
+     */
+    std::vector<double> d_web_area;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
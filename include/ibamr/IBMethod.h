@@ -261,6 +261,12 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * Advance the positions of the Lagrangian structure using num_substeps
+     * explicit substeps, and compute the time-averaged Lagrangian force.
+     */
+    void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -188,6 +188,16 @@ public:
      */
     virtual void postprocessIntegrateData(double current_time, double new_time, int num_cycles);
 
+    /*!
+     * Method to discard the data set up by preprocessIntegrateData() so that
+     * the time step can be repeated, e.g. after the time step is rejected by an
+     * adaptive time step size controller.  The Lagrangian data at current_time
+     * must not be modified.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void resetIntegrateData(double current_time, double new_time, int num_cycles);
+
     /*!
      * Indicate whether "fixed" interpolation and spreading operators should be
      * used during Lagrangian-Eulerian interaction.
@@ -240,6 +250,24 @@ public:
      */
     virtual void trapezoidalStep(double current_time, double new_time) = 0;
 
+    /*!
+     * Advance the positions of the Lagrangian structure using num_substeps
+     * explicit substeps, and compute the Lagrangian force averaged over the
+     * time interval.
+     *
+     * During the substeps, the structure moves with the Lagrangian velocity at
+     * the beginning of the time interval, or, when interpolate_velocity is
+     * true, with the velocity linearly interpolated in time between the
+     * velocities at the beginning and end of the time interval.  The averaged
+     * force is stored as the force at the midpoint of the time interval, so
+     * that it may be spread to the Cartesian grid by a subsequent call to
+     * spreadForce().
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -154,6 +154,12 @@ public:
      */
     void postprocessIntegrateData(double current_time, double new_time, int num_cycles);
 
+    /*!
+     * Method to discard the data set up by preprocessIntegrateData() so that
+     * the time step can be repeated.
+     */
+    void resetIntegrateData(double current_time, double new_time, int num_cycles);
+
     /*!
      * Update the positions used for the "fixed" interpolation and spreading
      * operators.
@@ -188,6 +194,13 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * Advance the positions of the Lagrangian structure using num_substeps
+     * explicit substeps, and compute the Lagrangian force averaged over the
+     * time interval.
+     */
+    void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -133,6 +133,35 @@ public:
      */
     void registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void* PK1_stress_fcn_ctx = NULL);
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function.
+     *
+     * The function is called with blocks of material points, and must set
+     * PP[k] to the PK1 stress tensor of the material point with deformation
+     * gradient FF[k], current position x[k], reference position X[k],
+     * subdomain ID subdomain_ids[k], and internal state variables
+     * *internal_vars[k].  All arrays have the same length.
+     */
+    typedef void (*PK1StressBatchFcnPtr)(std::vector<libMesh::TensorValue<double> >& PP,
+                                         const std::vector<libMesh::TensorValue<double> >& FF,
+                                         const std::vector<libMesh::Point>& x,
+                                         const std::vector<libMesh::Point>& X,
+                                         const std::vector<libMesh::subdomain_id_type>& subdomain_ids,
+                                         const std::vector<std::vector<double>*>& internal_vars,
+                                         double time,
+                                         void* ctx);
+
+    /*!
+     * Register a batched function to compute the first Piola-Kirchhoff stress
+     * tensor.  Evaluating the stresses of many material points per call allows
+     * the constitutive law to be vectorized.
+     *
+     * \note Registering a batched function replaces any previously registered
+     * pointwise function, and vice versa.
+     */
+    void registerPK1StressTensorFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn,
+                                         void* PK1_stress_batch_fcn_ctx = NULL);
+
     /*!
      * Supply a Lagrangian initialization object.
      */
@@ -372,6 +401,8 @@ protected:
      */
     PK1StressFcnPtr d_PK1_stress_fcn;
     void* d_PK1_stress_fcn_ctx;
+    PK1StressBatchFcnPtr d_PK1_stress_batch_fcn;
+    void* d_PK1_stress_batch_fcn_ctx;
 
     /*
      * Lagrangian variables.
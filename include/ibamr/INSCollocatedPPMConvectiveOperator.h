@@ -47,6 +47,7 @@
 #include "RefinePatchStrategy.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_enums.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -213,6 +214,9 @@ private:
     int d_U_scratch_idx;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_u_extrap_var, d_u_flux_var;
     int d_u_extrap_idx, d_u_flux_idx;
+
+    // Workspace for patch-local temporary data.
+    IBTK::PatchDataWorkspace d_workspace;
 };
 } // namespace IBAMR
 
@@ -50,6 +50,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/PoissonSolver.h"
+#include "mpi.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -402,6 +403,27 @@ protected:
      */
     virtual double getStableTimestep(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const = 0;
 
+    /*!
+     * Reset the current data to equal the new data, and initiate the
+     * computation of the stable time step sizes that will be used to determine
+     * the size of the next time step.
+     *
+     * The per-level stable time step sizes are computed from the updated
+     * velocity data and are combined in a single nonblocking reduction, so
+     * that the global reduction may be overlapped with any work that occurs
+     * before the next call to getMaximumTimeStepSizeSpecialized().
+     */
+    void resetTimeDependentHierarchyDataSpecialized(double new_time);
+
+    /*!
+     * Discard any stable time step sizes computed from previous velocity data.
+     *
+     * \note Implementations must call this function whenever the current
+     * velocity data are modified outside of the time integration loop, e.g.,
+     * following regridding.
+     */
+    void resetStableTimestepCache();
+
     /*!
      * Write out specialized object state to the given database.
      */
@@ -447,6 +469,15 @@ protected:
      */
     double d_cfl_max;
 
+    /*!
+     * Per-level stable time step sizes computed at the end of the preceding
+     * time step, along with the state of the (possibly nonblocking) reduction
+     * used to compute them.
+     */
+    std::vector<double> d_level_stable_dt_local, d_level_stable_dt;
+    MPI_Request d_level_stable_dt_request;
+    bool d_level_stable_dt_reduction_pending, d_level_stable_dt_is_valid;
+
     /*!
      * Cell tagging criteria based on the relative and absolute magnitudes of
      * the local vorticity.
@@ -563,6 +594,12 @@ private:
      */
     INSHierarchyIntegrator& operator=(const INSHierarchyIntegrator& that);
 
+    /*!
+     * Complete any outstanding reduction of the per-level stable time step
+     * sizes.
+     */
+    void finalizeStableTimestepReduction();
+
     /*!
      * Read input values from a given database.
      */
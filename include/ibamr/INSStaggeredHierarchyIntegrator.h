@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -89,6 +90,15 @@ namespace IBAMR
 /*!
  * \brief Class INSStaggeredHierarchyIntegrator provides a staggered-grid solver
  * for the incompressible Navier-Stokes equations on an AMR grid hierarchy.
+ *
+ * The initial guess used by the Stokes solver on the first cycle of each time
+ * step may be extrapolated from the solutions of the preceding time steps by
+ * setting the input key <code>initial_guess_extrapolation_type</code> to
+ * <code>"POLYNOMIAL"</code> (Lagrange extrapolation in time) or
+ * <code>"LEAST_SQUARES"</code> (minimal-residual combination of the stored
+ * solutions).  The number of stored solutions is set by
+ * <code>solution_history_size</code> (default 3).  The history is discarded
+ * whenever the patch hierarchy is regridded.
  */
 class INSStaggeredHierarchyIntegrator : public INSHierarchyIntegrator
 {
@@ -236,6 +246,22 @@ protected:
      */
     double getStableTimestep(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
 
+    /*!
+     * Estimate the relative error of the current time step from the difference
+     * between the velocity computed in the first cycle and the velocity
+     * computed in the final cycle.
+     *
+     * \note An error estimate is only available when adaptive time stepping
+     * is enabled and the time step uses more than one cycle.
+     */
+    double getTimeStepErrorEstimateSpecialized();
+
+    /*!
+     * Reset the integrator to the state at the beginning of the current time
+     * step.
+     */
+    void resetIntegratorToPreadvanceStateSpecialized();
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -322,6 +348,26 @@ private:
      */
     TimeSteppingType getConvectiveTimeSteppingType(int cycle_num);
 
+    /*!
+     * Replace the initial guess for the Stokes solver by an extrapolation of
+     * the solutions obtained on the preceding time steps.
+     */
+    void extrapolateInitialGuess(const SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                 const SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& rhs_vec,
+                                 double current_time,
+                                 double new_time);
+
+    /*!
+     * Add the solution of the current time step to the solution history used
+     * to extrapolate initial guesses.
+     */
+    void updateSolutionHistory(double current_time, double new_time);
+
+    /*!
+     * Free the solution history and any associated workspace.
+     */
+    void clearSolutionHistory();
+
     /*!
      * Hierarchy operations objects.
      */
@@ -344,6 +390,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_U_rhs_vec;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_U_adv_vec;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_N_vec;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_U_err_vec;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_P_scratch_vec;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_P_rhs_vec;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_sol_vec;
@@ -357,6 +404,36 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Data used to lag the reinitialization of the Stokes solver and the
+     * velocity subdomain solver (and their preconditioners) when the time step
+     * size changes.
+     *
+     * When lagging is enabled, the solvers are only reinitialized when the
+     * relative change in the coefficient C = rho/dt + K*lambda since the last
+     * reinitialization exceeds d_solver_reinit_rel_change_tol, or when the
+     * number of Stokes solver iterations grows by more than a factor of
+     * d_solver_reinit_iteration_growth_factor relative to the first solve
+     * following the last reinitialization.
+     */
+    bool d_lag_solver_reinitialization;
+    double d_solver_reinit_rel_change_tol, d_solver_reinit_iteration_growth_factor;
+    double d_solver_init_U_problem_C;
+    int d_solver_init_num_iterations;
+    bool d_solver_convergence_degraded;
+
+    /*
+     * Solution history used to extrapolate initial guesses for the Stokes
+     * solver.
+     */
+    std::string d_initial_guess_extrapolation_type;
+    int d_solution_history_size;
+    std::deque<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_sol_history_vecs;
+    std::deque<double> d_U_history_times, d_P_history_times;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_extrap_res_vec;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_extrap_basis_vecs,
+        d_extrap_image_vecs;
+
     /*!
      * Fluid solver variables.
      */
@@ -45,6 +45,7 @@
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -72,6 +73,12 @@ namespace IBAMR
  * a side-centered velocity field using the xsPPM7 method of Rider, Greenough,
  * and Kamm.
  *
+ * By default, the face values and the flux differences are computed together
+ * by a fused kernel that sweeps over each patch one cache-sized tile at a
+ * time.  Setting the input database key <tt>use_fused_ppm_kernel</tt> to
+ * <tt>FALSE</tt> selects the original multi-pass implementation, which
+ * produces identical results.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredPPMConvectiveOperator : public ConvectiveOperator
@@ -202,6 +209,13 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Workspace for patch-local temporary data.
+    IBTK::PatchDataWorkspace d_workspace;
+
+    // Fused kernel configuration and per-thread tile buffers.
+    bool d_use_fused_ppm_kernel;
+    std::vector<double> d_tile_data;
 };
 } // namespace IBAMR
 
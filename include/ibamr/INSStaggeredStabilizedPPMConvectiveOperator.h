@@ -46,6 +46,7 @@
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -210,6 +211,9 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Workspace for patch-local temporary data.
+    IBTK::PatchDataWorkspace d_workspace;
 };
 } // namespace IBAMR
 
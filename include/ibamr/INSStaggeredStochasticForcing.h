@@ -189,6 +189,21 @@ private:
      */
     double d_velocity_bc_scaling, d_traction_bc_scaling;
 
+    /*!
+     * Seed for the counter-based random number generator.  Random values are
+     * keyed on this seed, the time step number, the index of the random value,
+     * the level number, and the global index and depth of each degree of
+     * freedom, so that they do not depend on the parallel decomposition of the
+     * patch hierarchy.
+     *
+     * If no seed is provided in the input database, the global seed set by
+     * RNG::parallel_seed() is used.  It is read when random values are first
+     * generated, so that RNG::parallel_seed() may be called after this object
+     * is constructed.
+     */
+    int d_seed;
+    bool d_seed_is_set;
+
     /*!
      * VariableContext and Variable objects for storing the components of the
      * stochastic stresses.
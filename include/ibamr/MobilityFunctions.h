@@ -114,6 +114,49 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Compute the product of the Rotne-Pragner-Yamakawa mobility matrix
+     * with a force vector without forming the matrix.
+     *
+     * Interactions between a marker and a well-separated cluster of markers
+     * are approximated using the far-field expansion of the RPY tensor about
+     * the cluster centroid, truncated after the force dipole term.  A cluster
+     * of radius \em R at distance \em r is considered well-separated when R <
+     * opening_angle * r.  The approximation error decreases quadratically with
+     * the opening angle, and the product is computed exactly in O(N^2)
+     * operations when the opening angle is zero.  Otherwise, the product
+     * requires O(N log N) operations and O(N) storage.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param F Array of forces applied to the IB markers.
+     *
+     * \param U Array of velocities of the IB markers.
+     *
+     * \param opening_angle Accuracy parameter of the approximation.
+     */
+    static void applyRPYMobilityMatrix(const char* kernel_name,
+                                       const double mu,
+                                       const double dx,
+                                       const double* X,
+                                       const int num_nodes,
+                                       const double periodic_correction,
+                                       const double* F,
+                                       double* U,
+                                       const double opening_angle = 0.0);
 }; // MobilityFunctions
 
 } // namespace IBAMR
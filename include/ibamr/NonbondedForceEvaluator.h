@@ -35,6 +35,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
@@ -45,6 +47,22 @@
 
 namespace IBAMR
 {
+// Class NonbondedForceEvaluator computes pairwise forces between nearby
+// Lagrangian nodes.
+//
+// Candidate pairs are determined from the cells occupied by the nodes, which
+// change only when the Lagrangian data are redistributed.  The pairs are
+// stored in a neighbor list that is reused between redistributions.  If
+// neighbor_list_cutoff is specified in the input database, only pairs within a
+// distance of neighbor_list_cutoff + neighbor_list_skin are kept, and the list
+// is also rebuilt whenever a node moves more than half of the skin distance.
+// In this case, the force function must vanish beyond neighbor_list_cutoff.
+//
+// Each pair of nodes is visited once, and equal and opposite forces are applied
+// to the two nodes.  When IBAMR is compiled with OpenMP enabled, the pair forces
+// are computed in parallel, and so the force function must be thread safe.  If
+// log_pair_throughput is set to TRUE in the input database, the number of pair
+// forces computed per second is written to the log file.
 class NonbondedForceEvaluator : public IBLagrangianForceStrategy
 {
 public:
@@ -61,13 +79,6 @@ public:
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
-    // Function to evaluate forces.
-    void evaluateForces(int mstr_petsc_idx,
-                        int search_petsc_idx,
-                        SAMRAI::tbox::Pointer<IBTK::LData> X_data,
-                        std::vector<int> cell_offset,
-                        SAMRAI::tbox::Pointer<IBTK::LData> F_data);
-
     // Implementation of computeLagrangianForce.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -90,6 +101,19 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that);
 
+    // Determine whether the neighbor list must be rebuilt.
+    bool neighborListNeedsRebuild(const double* X,
+                                  int num_local_values,
+                                  int level_number,
+                                  IBTK::LDataManager* l_data_manager);
+
+    // Rebuild the neighbor list from the cells occupied by the nodes.
+    void buildNeighborList(const double* X,
+                           int num_local_values,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
     // type of force to use:
     int d_force_type;
 
@@ -105,6 +129,27 @@ private:
     // grid geometry
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 
+    // neighbor list cutoff and skin distances; the list is not pruned by
+    // distance when the cutoff is negative.
+    double d_neighbor_list_cutoff, d_neighbor_list_skin;
+
+    // neighbor list, stored as arrays of local PETSc indices of the interacting
+    // nodes along with the periodic shifts of the second node of each pair.
+    bool d_neighbor_list_is_valid;
+    int d_neighbor_list_level_number;
+    unsigned int d_neighbor_list_redistribution_count;
+    std::vector<int> d_neighbor_mstr_idxs, d_neighbor_search_idxs;
+    std::vector<double> d_neighbor_periodic_shifts;
+
+    // node positions at the time that the neighbor list was built.
+    std::vector<double> d_neighbor_list_X;
+
+    // force buffers for the blocks of pairs other than the first one.
+    std::vector<std::vector<double> > d_thread_force_data;
+
+    // whether to log the pair force throughput.
+    bool d_log_pair_throughput;
+
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <string>
+#include <vector>
 
 #include "ibamr/KrylovLinearSolverStaggeredStokesSolverInterface.h"
 #include "ibtk/PETScKrylovLinearSolver.h"
@@ -43,6 +44,12 @@
 
 namespace SAMRAI
 {
+namespace solv
+{
+class PoissonSpecifications;
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
 namespace tbox
 {
 class Database;
@@ -57,6 +64,17 @@ namespace IBAMR
  * \brief Class PETScKrylovStaggeredStokesSolver is an extension of class
  * PETScKrylovLinearSolver that provides an implementation of the
  * StaggeredStokesSolver interface.
+ *
+ * When the input key <code>enable_krylov_recycling</code> is set to
+ * <code>TRUE</code>, the solver retains a subspace \f$ U \f$ spanned by the
+ * corrections computed by previous solves, along with its image \f$ C = A U
+ * \f$, which is kept orthonormal.  Before each solve, the initial guess is
+ * augmented by the minimal-residual correction from \f$ U \f$, so that only
+ * the component of the error not already captured by the recycled subspace
+ * must be resolved by the Krylov method.  At most
+ * <code>max_recycled_vectors</code> (default 8) vectors are retained.  The
+ * recycled subspace is discarded whenever the solver is reinitialized or the
+ * velocity problem coefficients change.
  */
 class PETScKrylovStaggeredStokesSolver : public IBTK::PETScKrylovLinearSolver,
                                          public KrylovLinearSolverStaggeredStokesSolverInterface
@@ -74,6 +92,39 @@ public:
      */
     ~PETScKrylovStaggeredStokesSolver();
 
+    /*!
+     * \brief Set the PoissonSpecifications object used to specify the
+     * coefficients for the momentum equation in the incompressible Stokes
+     * operator.
+     *
+     * \note Any recycled subspace is discarded when the coefficients change.
+     */
+    void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$,
+     * using the recycled subspace (when enabled) to improve the initial guess.
+     *
+     * \see IBTK::PETScKrylovLinearSolver::solveSystem
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * \see IBTK::PETScKrylovLinearSolver::initializeSolverState
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \see IBTK::PETScKrylovLinearSolver::deallocateSolverState
+     */
+    void deallocateSolverState();
+
 protected:
 private:
     /*!
@@ -102,6 +153,28 @@ private:
      * \return A reference to this object.
      */
     PETScKrylovStaggeredStokesSolver& operator=(const PETScKrylovStaggeredStokesSolver& that);
+
+    /*!
+     * \brief Add the correction computed by the most recent solve to the
+     * recycled subspace.
+     */
+    void updateRecycledSubspace(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
+    /*!
+     * \brief Free the recycled subspace and the associated workspace.
+     */
+    void clearRecycledSubspace();
+
+    /*
+     * Recycled subspace data.
+     */
+    bool d_enable_krylov_recycling;
+    int d_max_recycled_vecs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_recycled_U_vecs,
+        d_recycled_C_vecs;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_recycling_x0_vec, d_recycling_r_vec;
+    bool d_U_problem_coefs_constant;
+    double d_U_problem_C, d_U_problem_D;
 };
 } // namespace IBAMR
 
@@ -123,6 +123,12 @@ public:
      */
     void trapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * Multirate time stepping is not supported by class PenaltyIBMethod; this
+     * method emits an unrecoverable exception.
+     */
+    void multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity);
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -1,6 +1,8 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+#include <stdint.h>
+
 namespace IBAMR
 {
 /*!
@@ -18,6 +20,37 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Return the global seed used by the most recent call to
+     * parallel_seed().
+     *
+     * Unlike the seeds of the per-process generators, this value is the same
+     * on all processes.
+     */
+    static int get_global_seed();
+
+    /*!
+     * \brief Evaluate the Philox-4x32-10 counter-based bijection for the
+     * specified counter and key.
+     *
+     * The result depends only on its arguments, so this function is
+     * thread-safe and may be evaluated in any order.
+     */
+    static void philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t result[4]);
+
+    /*!
+     * \brief Fill values[0], ..., values[n-1] with standard normal random
+     * numbers generated by the Philox-4x32-10 counter-based generator.
+     *
+     * values[m] is determined by the key, the stream, and the global index
+     * i_lower + m.  Each group of four consecutive global indices shares one
+     * counter, and the four uniform values are converted to normal values by
+     * the Box-Muller transform.  The generated values are therefore
+     * independent of how the index space is partitioned among patches,
+     * processes, or threads.
+     */
+    static void genrandn(double* values, int n, int i_lower, const uint32_t stream[3], const uint32_t key[2]);
+
 private:
     RNG();
     RNG(RNG&);
@@ -97,6 +97,16 @@ public:
      */
     virtual const SAMRAI::solv::PoissonSpecifications& getVelocityPoissonSpecifications() const;
 
+    /*!
+     * \brief Enable or disable the fused patch kernel that is used by apply()
+     * when the velocity problem coefficients are spatially constant.
+     *
+     * The fused kernel is enabled by default.  The unfused evaluation, which
+     * uses the separate HierarchyMathOps differencing operators, gives the same
+     * result up to round-off.
+     */
+    void setFusedApplyEnabled(bool enabled);
+
     /*!
      * \brief Set the SAMRAI::solv::RobinBcCoefStrategy objects used to specify
      * physical boundary conditions.
@@ -256,6 +266,25 @@ private:
      * \return A reference to this object.
      */
     StaggeredStokesOperator& operator=(const StaggeredStokesOperator& that);
+
+    /*!
+     * \brief Compute y=Ax for spatially constant velocity problem coefficients
+     * using a single fused pass over each patch.
+     *
+     * The coarse-fine interface is treated in the same way as by the unfused
+     * evaluation: the momentum residual is computed from the unsynchronized
+     * velocity and is then synchronized, and the continuity residual on each
+     * coarser level is recomputed after the velocity has been synchronized.
+     *
+     * \note Ghost cell values of the scratch velocity and of the pressure must
+     * be filled prior to calling this method.
+     */
+    void applyFused(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& y);
+
+    /*!
+     * Whether apply() may use applyFused().
+     */
+    bool d_use_fused_apply;
 };
 } // namespace IBAMR
 
@@ -326,6 +326,37 @@ CIBFEMethod::postprocessIntegrateData(double current_time, double new_time, int
     return;
 } // postprocessIntegrateData
 
+void
+CIBFEMethod::resetIntegrateData(double current_time, double new_time, int num_cycles)
+{
+    // Destroy the free DOFs.
+    VecDestroy(&d_U);
+    VecDestroy(&d_F);
+
+    // Deallocate Lagrangian scratch data without updating the rigid body
+    // state.
+    for (unsigned part = 0; part < d_num_rigid_parts; ++part)
+    {
+        delete d_F_new_vecs[part];
+        delete d_U_constrained_half_vecs[part];
+    }
+
+    d_F_current_vecs.clear();
+    d_F_new_vecs.clear();
+    d_vL_current.clear();
+    d_vL_new.clear();
+    VecDestroy(&d_mv_L_current);
+    VecDestroy(&d_mv_L_new);
+
+    d_U_constrained_systems.clear();
+    d_U_constrained_current_vecs.clear();
+    d_U_constrained_half_vecs.clear();
+
+    // Clean the temporary FE data vecs.
+    IBFEMethod::resetIntegrateData(current_time, new_time, num_cycles);
+    return;
+} // resetIntegrateData
+
 bool
 CIBFEMethod::setComputeVelL2Projection(const bool compute_L2_projection)
 {
@@ -527,6 +558,18 @@ CIBFEMethod::trapezoidalStep(const double /*current_time*/, const double /*new_t
                << std::endl);
 } // trapezoidalStep
 
+void
+CIBFEMethod::multirateStep(const double /*current_time*/,
+                          const double /*new_time*/,
+                          const int /*num_substeps*/,
+                          const bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR(d_object_name << "::multirateStep():\n"
+                             << "  multirate time stepping not supported by class CIBFEMethod;\n"
+                             << "  use num_structure_substeps = 1 instead.\n");
+    return;
+} // multirateStep
+
 void
 CIBFEMethod::computeLagrangianForce(double /*data_time*/)
 {
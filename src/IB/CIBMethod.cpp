@@ -664,49 +664,49 @@ CIBMethod::forwardEulerStep(double current_time, double new_time)
         boost::multi_array_ref<double, 2>& X_half_array = *((*X_half_data)[ln]->getLocalFormVecArray());
         const boost::multi_array_ref<double, 2>& X0_array =
             *(d_l_data_manager->getLData("X0_unshifted", ln)->getLocalFormVecArray());
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
         // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::sort(structIDs.begin(), structIDs.end());
         const unsigned structs_on_this_ln = static_cast<unsigned>(structIDs.size());
 #if !defined(NDEBUG)
         TBOX_ASSERT(structs_on_this_ln == d_num_rigid_parts);
 #endif
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        for (unsigned struct_handle = 0; struct_handle < structs_on_this_ln; ++struct_handle)
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            const int local_idx = node_idx->getLocalPETScIndex();
-            double* const X_half = &X_half_array[local_idx][0];
-            const double* const X0 = &X0_array[local_idx][0];
-            Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-            Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
-
-            int struct_handle = 0;
-            if (structs_on_this_ln > 1) struct_handle = getStructureHandle(lag_idx);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
+            const std::vector<int>& struct_local_idxs =
+                d_l_data_manager->getLocalLagrangianStructureNodeIndices(structIDs[struct_handle], ln);
+            for (std::vector<int>::const_iterator cit = struct_local_idxs.begin(); cit != struct_local_idxs.end();
+                 ++cit)
             {
-                dr[d] = X0[d] - d_center_of_mass_initial[struct_handle][d];
-            }
+                const int local_idx = *cit;
+                double* const X_half = &X_half_array[local_idx][0];
+                const double* const X0 = &X0_array[local_idx][0];
+                Eigen::Vector3d dr = Eigen::Vector3d::Zero();
+                Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
 
-            // Rotate dr vector using the rotation matrix.
-            R_dr = rotation_mat[struct_handle] * dr;
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_half[d] = d_center_of_mass_current[struct_handle][d] + R_dr[d] +
-                            0.5 * dt * d_trans_vel_current[struct_handle][d];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    dr[d] = X0[d] - d_center_of_mass_initial[struct_handle][d];
+                }
 
-                if (periodic_shift[d])
+                // Rotate dr vector using the rotation matrix.
+                R_dr = rotation_mat[struct_handle] * dr;
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    while (X_half[d] < domain_x_lower[d])
-                    {
-                        X_half[d] += domain_length[d];
-                    }
-                    while (X_half[d] >= domain_x_upper[d])
+                    X_half[d] = d_center_of_mass_current[struct_handle][d] + R_dr[d] +
+                                0.5 * dt * d_trans_vel_current[struct_handle][d];
+
+                    if (periodic_shift[d])
                     {
-                        X_half[d] -= domain_length[d];
+                        while (X_half[d] < domain_x_lower[d])
+                        {
+                            X_half[d] += domain_length[d];
+                        }
+                        while (X_half[d] >= domain_x_upper[d])
+                        {
+                            X_half[d] -= domain_length[d];
+                        }
                     }
                 }
             }
@@ -784,53 +784,53 @@ CIBMethod::midpointStep(double current_time, double new_time)
         boost::multi_array_ref<double, 2>& X_new_array = *d_X_new_data[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X0_array =
             *(d_l_data_manager->getLData("X0_unshifted", ln)->getLocalFormVecArray());
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
         // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::sort(structIDs.begin(), structIDs.end());
         const unsigned structs_on_this_ln = (unsigned)structIDs.size();
 #if !defined(NDEBUG)
         TBOX_ASSERT(structs_on_this_ln == d_num_rigid_parts);
 #endif
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        for (unsigned struct_handle = 0; struct_handle < structs_on_this_ln; ++struct_handle)
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            const int local_idx = node_idx->getLocalPETScIndex();
-            double* const X_new = &X_new_array[local_idx][0];
-            const double* const X0 = &X0_array[local_idx][0];
-            Eigen::Vector3d dr = Eigen::Vector3d::Zero();
-            Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
-
-            int struct_handle = 0;
-            if (structs_on_this_ln > 1) struct_handle = getStructureHandle(lag_idx);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
+            const std::vector<int>& struct_local_idxs =
+                d_l_data_manager->getLocalLagrangianStructureNodeIndices(structIDs[struct_handle], ln);
+            for (std::vector<int>::const_iterator cit = struct_local_idxs.begin(); cit != struct_local_idxs.end();
+                 ++cit)
             {
-                dr[d] = X0[d] - d_center_of_mass_initial[struct_handle][d];
-            }
+                const int local_idx = *cit;
+                double* const X_new = &X_new_array[local_idx][0];
+                const double* const X0 = &X0_array[local_idx][0];
+                Eigen::Vector3d dr = Eigen::Vector3d::Zero();
+                Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
 
-            // Rotate dr vector using the rotation matrix.
-            R_dr = rotation_mat[struct_handle] * dr;
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X_new[d] =
-                    d_center_of_mass_current[struct_handle][d] + R_dr[d] +
-                    dt * (is_steady_stokes ? d_trans_vel_new[struct_handle][d] : d_trans_vel_half[struct_handle][d]);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    dr[d] = X0[d] - d_center_of_mass_initial[struct_handle][d];
+                }
 
-                if (periodic_shift[d])
+                // Rotate dr vector using the rotation matrix.
+                R_dr = rotation_mat[struct_handle] * dr;
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    while (X_new[d] < domain_x_lower[d])
-                    {
-                        X_new[d] += domain_length[d];
-                        flag_regrid = 1;
-                    }
-                    while (X_new[d] >= domain_x_upper[d])
+                    X_new[d] = d_center_of_mass_current[struct_handle][d] + R_dr[d] +
+                               dt * (is_steady_stokes ? d_trans_vel_new[struct_handle][d] :
+                                                        d_trans_vel_half[struct_handle][d]);
+
+                    if (periodic_shift[d])
                     {
-                        X_new[d] -= domain_length[d];
-                        flag_regrid = 1;
+                        while (X_new[d] < domain_x_lower[d])
+                        {
+                            X_new[d] += domain_length[d];
+                            flag_regrid = 1;
+                        }
+                        while (X_new[d] >= domain_x_upper[d])
+                        {
+                            X_new[d] -= domain_length[d];
+                            flag_regrid = 1;
+                        }
                     }
                 }
             }
@@ -885,6 +885,18 @@ CIBMethod::trapezoidalStep(double /*current_time*/, double /*new_time*/)
     return;
 } // trapezoidalStep
 
+void
+CIBMethod::multirateStep(const double /*current_time*/,
+                        const double /*new_time*/,
+                        const int /*num_substeps*/,
+                        const bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR(d_object_name << "::multirateStep():\n"
+                             << "  multirate time stepping not supported by class CIBMethod;\n"
+                             << "  use num_structure_substeps = 1 instead.\n");
+    return;
+} // multirateStep
+
 void
 CIBMethod::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_writer)
 {
@@ -1167,19 +1179,16 @@ CIBMethod::computeNetRigidGeneralizedForce(const unsigned int part, Vec L, Rigid
     Eigen::Vector3d dr = Eigen::Vector3d::Zero();
     Eigen::Vector3d R_dr = Eigen::Vector3d::Zero();
 
-    // Loop over LMesh.
+    // Loop over the local nodes of the part.
     F.setZero();
-    const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(struct_ln);
-    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(struct_ln);
+    std::sort(structIDs.begin(), structIDs.end());
+    const std::vector<int>& struct_local_idxs =
+        d_l_data_manager->getLocalLagrangianStructureNodeIndices(structIDs[part], struct_ln);
+    for (std::vector<int>::const_iterator cit = struct_local_idxs.begin(); cit != struct_local_idxs.end(); ++cit)
     {
-        const LNode* const node_idx = *cit;
-        const int lag_idx = node_idx->getLagrangianIndex();
-        const int local_idx = node_idx->getLocalPETScIndex();
+        const int local_idx = *cit;
         const double* const P = &p_data_array[local_idx][0];
-        const unsigned struct_id = getStructureHandle(lag_idx);
-        if (struct_id != part) continue;
-
         const double* const X0 = &X0_array[local_idx][0];
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -1748,32 +1757,33 @@ CIBMethod::computeCOMOfStructures(std::vector<Eigen::Vector3d>& center_of_mass,
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
         const boost::multi_array_ref<double, 2>& X_data_array = *X_data[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
         // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        std::sort(structIDs.begin(), structIDs.end());
         const unsigned structs_on_this_ln = static_cast<unsigned>(structIDs.size());
 #if !defined(NDEBUG)
         TBOX_ASSERT(structs_on_this_ln == d_num_rigid_parts);
 #endif
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        // Accumulate the local sums of all structures and reduce them at once.
+        std::vector<double> X_sum(NDIM * structs_on_this_ln, 0.0);
+        for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            const int local_idx = node_idx->getLocalPETScIndex();
-            const double* const X = &X_data_array[local_idx][0];
-
-            int struct_handle = 0;
-            if (structs_on_this_ln > 1) struct_handle = getStructureHandle(lag_idx);
-
-            for (unsigned int d = 0; d < NDIM; ++d) center_of_mass[struct_handle][d] += X[d];
+            const std::vector<int>& struct_local_idxs =
+                d_l_data_manager->getLocalLagrangianStructureNodeIndices(structIDs[struct_no], ln);
+            for (std::vector<int>::const_iterator cit = struct_local_idxs.begin(); cit != struct_local_idxs.end();
+                 ++cit)
+            {
+                const double* const X = &X_data_array[*cit][0];
+                for (unsigned int d = 0; d < NDIM; ++d) X_sum[NDIM * struct_no + d] += X[d];
+            }
         }
+        if (structs_on_this_ln > 0) SAMRAI_MPI::sumReduction(&X_sum[0], NDIM * structs_on_this_ln);
 
         for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
         {
-            SAMRAI_MPI::sumReduction(&center_of_mass[struct_no][0], NDIM);
+            for (unsigned int d = 0; d < NDIM; ++d) center_of_mass[struct_no][d] += X_sum[NDIM * struct_no + d];
             const int total_nodes = getNumberOfNodes(struct_no);
             center_of_mass[struct_no] /= total_nodes;
         }
@@ -140,6 +140,26 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Sum a collection of arrays over all processes using a single reduction.
+inline void
+fused_sum_reduction(const std::vector<std::pair<double*, int> >& arrays)
+{
+    int size = 0;
+    for (unsigned int k = 0; k < arrays.size(); ++k) size += arrays[k].second;
+    if (size == 0) return;
+    std::vector<double> buffer(size);
+    for (unsigned int k = 0, offset = 0; k < arrays.size(); offset += arrays[k].second, ++k)
+    {
+        std::copy(arrays[k].first, arrays[k].first + arrays[k].second, &buffer[offset]);
+    }
+    SAMRAI_MPI::sumReduction(&buffer[0], size);
+    for (unsigned int k = 0, offset = 0; k < arrays.size(); offset += arrays[k].second, ++k)
+    {
+        std::copy(&buffer[offset], &buffer[offset] + arrays[k].second, arrays[k].first);
+    }
+    return;
+} // fused_sum_reduction
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -185,6 +205,7 @@ ConstraintIBMethod::ConstraintIBMethod(const std::string& object_name,
       d_moment_of_inertia_new(d_no_structures, Eigen::Matrix3d::Zero()),
       d_tagged_pt_lag_idx(d_no_structures, 0),
       d_tagged_pt_position(d_no_structures, std::vector<double>(3, 0.0)),
+      d_local_node_struct_handles_redistribution_count(0),
       d_rho_fluid(std::numeric_limits<double>::quiet_NaN()),
       d_mu_fluid(std::numeric_limits<double>::quiet_NaN()),
       d_timestep_counter(0),
@@ -785,8 +806,6 @@ ConstraintIBMethod::getFromRestart()
 void
 ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-
     calculateCOMandMOIOfStructures();
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -796,22 +815,81 @@ ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_center_of_mass_current[struct_no],
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(0.0, d_incremented_angle_from_reference_axis[struct_no]);
+    }
+    calculateMomentumOfKinematicsVelocity();
 
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
-
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
         d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
         d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
     }
     return;
 } // setInitialLagrangianVelocity
 
+void
+ConstraintIBMethod::updateLocalNodeStructureHandles()
+{
+    // The local nodes only change when the Lagrangian data are redistributed.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    bool needs_update =
+        static_cast<int>(d_local_node_struct_handles.size()) != finest_ln + 1 ||
+        d_l_data_manager->getNumberOfDataRedistributions() != d_local_node_struct_handles_redistribution_count;
+    for (int ln = 0; ln <= finest_ln && !needs_update; ++ln)
+    {
+        const size_t num_local_nodes = d_l_data_manager->levelContainsLagrangianData(ln) ?
+                                           d_l_data_manager->getLMesh(ln)->getLocalNodes().size() :
+                                           0;
+        needs_update = d_local_node_struct_handles[ln].size() != num_local_nodes;
+    }
+    if (!needs_update) return;
+
+    d_local_node_struct_handles.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
+        struct_handles.clear();
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+
+        // Tag the local nodes of each structure on this level with the position
+        // of the structure in d_ib_kinematics.
+        std::vector<int> local_petsc_idx_struct_handles(
+            d_l_data_manager->getLocalLagrangianStructureIDs(ln).size(), -1);
+        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+        for (unsigned int struct_no = 0; struct_no < structIDs.size(); ++struct_no)
+        {
+            std::pair<int, int> lag_idx_range =
+                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+            std::vector<Pointer<ConstraintIBKinematics> >::const_iterator kit =
+                std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+            if (kit == d_ib_kinematics.end()) continue;
+            const int location_struct_handle =
+                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), *kit);
+            const std::vector<int>& struct_local_idxs =
+                d_l_data_manager->getLocalLagrangianStructureNodeIndices(structIDs[struct_no], ln);
+            for (unsigned int k = 0; k < struct_local_idxs.size(); ++k)
+            {
+                local_petsc_idx_struct_handles[struct_local_idxs[k]] = location_struct_handle;
+            }
+        }
+
+        const std::vector<LNode*>& local_nodes = d_l_data_manager->getLMesh(ln)->getLocalNodes();
+        struct_handles.resize(local_nodes.size(), -1);
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
+        {
+            struct_handles[k] = local_petsc_idx_struct_handles[local_nodes[k]->getLocalPETScIndex()];
+        }
+    }
+    d_local_node_struct_handles_redistribution_count = d_l_data_manager->getNumberOfDataRedistributions();
+    return;
+} // updateLocalNodeStructureHandles
+
 void
 ConstraintIBMethod::calculateCOMandMOIOfStructures()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    updateLocalNodeStructureHandles();
 
     // Zero out the COM vector.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -844,77 +922,60 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double X_com_current[NDIM] = { 0.0 }, X_com_new[NDIM] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0) continue;
+            const LNode* const node_idx = local_nodes[k];
+            const int lag_idx = node_idx->getLagrangianIndex();
+            const int local_idx = node_idx->getLocalPETScIndex();
+            const double* const X_current = &X_data_current[local_idx][0];
+            const double* const X_new = &X_data_new[local_idx][0];
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_com_current[d] += X_current[d];
-                        X_com_new[d] += X_new[d];
-                    }
-                    if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
-                    {
-                        for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
-                    }
-                }
+                d_center_of_mass_current[location_struct_handle][d] += X_current[d];
+                d_center_of_mass_new[location_struct_handle][d] += X_new[d];
             }
-            for (int d = 0; d < NDIM; ++d)
+            if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
             {
-                d_center_of_mass_current[location_struct_handle][d] += X_com_current[d];
-                d_center_of_mass_new[location_struct_handle][d] += X_com_new[d];
+                for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
             }
         }
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_arrays.push_back(std::make_pair(&d_center_of_mass_current[struct_no][0], NDIM));
+        reduction_arrays.push_back(std::make_pair(&d_center_of_mass_new[struct_no][0], NDIM));
+        reduction_arrays.push_back(std::make_pair(&tagged_position[struct_no][0], 3));
+    }
+    fused_sum_reduction(reduction_arrays);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
-
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
             d_center_of_mass_new[struct_no][i] /= total_nodes;
         }
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
     // Zero out the moment of inertia tensor.
+    std::vector<bool> struct_is_self_rotating(d_no_structures);
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         d_moment_of_inertia_current[struct_no].setZero();
         d_moment_of_inertia_new[struct_no].setZero();
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        struct_is_self_rotating[struct_no] = struct_param.getStructureIsSelfRotating();
     }
 
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -937,87 +998,66 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0 || !struct_is_self_rotating[location_struct_handle]) continue;
             const std::vector<double>& X_com_current = d_center_of_mass_current[location_struct_handle];
             const std::vector<double>& X_com_new = d_center_of_mass_new[location_struct_handle];
+            Eigen::Matrix3d& Inertia_current = d_moment_of_inertia_current[location_struct_handle];
+            Eigen::Matrix3d& Inertia_new = d_moment_of_inertia_new[location_struct_handle];
 
-            Eigen::Matrix3d Inertia_current(3, 3), Inertia_new(3, 3);
-            Inertia_current.setZero();
-            Inertia_new.setZero();
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const X_current = &X_data_current[local_idx][0];
+            const double* const X_new = &X_data_new[local_idx][0];
 #if (NDIM == 2)
-                    Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
+            Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+            Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
+            Inertia_current(2, 2) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+            Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+            Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
+            Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
 
 #if (NDIM == 3)
-                    Inertia_current(0, 0) +=
-                        std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(1, 1) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_current(0, 0) +=
+                std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+            Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+            Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
+            Inertia_current(1, 1) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+            Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
+            Inertia_current(2, 2) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+            Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+            Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+            Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
+            Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+            Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
+            Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
-                }
-            }
-            d_moment_of_inertia_current[location_struct_handle] += Inertia_current;
-            d_moment_of_inertia_new[location_struct_handle] += Inertia_new;
-        } // all structs
+        }
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    reduction_arrays.clear();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
+        if (struct_is_self_rotating[struct_no])
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            reduction_arrays.push_back(std::make_pair(&d_moment_of_inertia_current[struct_no](0, 0), 9));
+            reduction_arrays.push_back(std::make_pair(&d_moment_of_inertia_new[struct_no](0, 0), 9));
         }
     }
+    fused_sum_reduction(reduction_arrays);
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1030,7 +1070,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         d_moment_of_inertia_new[struct_no](2, 0) = d_moment_of_inertia_new[struct_no](0, 2);
         d_moment_of_inertia_new[struct_no](2, 1) = d_moment_of_inertia_new[struct_no](1, 2);
     }
-
     // write the COM and MOI to the output file
     if (!SAMRAI_MPI::getRank() && d_print_output && d_output_COM_coordinates &&
         (d_timestep_counter % d_output_interval) == 0 && !MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
@@ -1066,13 +1105,10 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 void
 ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1083,153 +1119,158 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity();
 
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
-    {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
-
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    updateLocalNodeStructureHandles();
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    // Zero out linear and angular momentum of kinematics velocity of the
+    // self-translating structures.
+    std::vector<bool> struct_is_self_translating(d_no_structures), struct_is_self_rotating(d_no_structures);
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        struct_is_self_translating[struct_no] = struct_param.getStructureIsSelfTranslating();
+        struct_is_self_rotating[struct_no] =
+            struct_is_self_translating[struct_no] && struct_param.getStructureIsSelfRotating();
+        if (struct_is_self_translating[struct_no])
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
+            for (int d = 0; d < 3; ++d) d_vel_com_def_new[struct_no][d] = 0.0;
         }
-        for (int d = 0; d < NDIM; ++d)
+        if (struct_is_self_rotating[struct_no])
         {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[struct_no][d] = 0.0;
         }
     }
-    SAMRAI_MPI::sumReduction(&d_vel_com_def_new[position_handle][0], NDIM);
 
-    for (int d = 0; d < 3; ++d)
+    // Calculate linear and angular momentum.
+    std::vector<const std::vector<std::vector<double> >*> def_vels(d_no_structures);
+    std::vector<int> offsets(d_no_structures);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        // Get the kinematics velocity of the structures on this level.
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            def_vels[struct_no] = NULL;
+            if (!struct_is_self_translating[struct_no]) continue;
+            const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+            const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
+            const int itr = ln - struct_param.getCoarsestLevelNumber();
+            if (ln > struct_param.getFinestLevelNumber() || itr < 0 || itr >= static_cast<int>(range.size())) continue;
+            def_vels[struct_no] = &d_ib_kinematics[struct_no]->getKinematicsVelocity(ln);
+            offsets[struct_no] = range[itr].first;
+        }
 
-        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
-             ++ln, ++itr)
+        // Get LData corresponding to the present position of the structures.
+        Pointer<LData> ptr_x_lag_data;
+        if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
         {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
+            ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
+        }
+        else
+        {
+            ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+        }
 
-            std::pair<int, int> lag_idx_range = range[itr];
-            const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
+        const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
+        {
+            const int position_handle = struct_handles[k];
+            if (position_handle < 0 || !def_vels[position_handle]) continue;
+            const std::vector<std::vector<double> >& def_vel = *def_vels[position_handle];
+            const LNode* const node_idx = local_nodes[k];
+            const int lag_idx = node_idx->getLagrangianIndex();
+            const int offset = offsets[position_handle];
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                d_vel_com_def_new[position_handle][d] += def_vel[d][lag_idx - offset];
             }
+            if (!struct_is_self_rotating[position_handle]) continue;
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
-            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+            const int local_idx = node_idx->getLocalPETScIndex();
+            const double* const X = &X_data[local_idx][0];
+            std::vector<double>& R_cross_U_def = d_omega_com_def_new[position_handle];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+            double x = X[0] - d_center_of_mass_new[position_handle][0];
+            double y = X[1] - d_center_of_mass_new[position_handle][1];
+            R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
+            double x = X[0] - d_center_of_mass_new[position_handle][0];
+            double y = X[1] - d_center_of_mass_new[position_handle][1];
+            double z = X[2] - d_center_of_mass_new[position_handle][2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+            R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+            R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+            R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
-                }
-            }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+        }
+        ptr_x_lag_data->restoreArrays();
+    } // all levels
+
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        if (struct_is_self_translating[struct_no])
+        {
+            reduction_arrays.push_back(std::make_pair(&d_vel_com_def_new[struct_no][0], NDIM));
+        }
+        if (struct_is_self_rotating[struct_no])
+        {
+            reduction_arrays.push_back(std::make_pair(&d_omega_com_def_new[struct_no][0], 3));
+        }
+    }
+    fused_sum_reduction(reduction_arrays);
+
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
+    {
+        if (!struct_is_self_translating[position_handle]) continue;
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] /= total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
 
+        if (struct_is_self_rotating[position_handle])
+        {
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
+            d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
 #endif
 
 #if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
-        for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+            solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
+            for (int d = 0; d < 3; ++d)
+                if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+        } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1371,6 +1412,14 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    updateLocalNodeStructureHandles();
+
+    std::vector<bool> struct_is_self_translating(d_no_structures);
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        struct_is_self_translating[struct_no] = struct_param.getStructureIsSelfTranslating();
+    }
 
     // Calculate rigid translational velocity.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -1381,49 +1430,37 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfTranslating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double U_rigid[NDIM] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0 || !struct_is_self_translating[location_struct_handle]) continue;
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U = &U_interp_data[local_idx][0];
+            for (int d = 0; d < NDIM; ++d)
             {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
-                }
+                d_rigid_trans_vel_new[location_struct_handle][d] += U[d];
             }
-            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
-        } // all structs
+        }
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        if (struct_is_self_translating[struct_no])
+        {
+            reduction_arrays.push_back(std::make_pair(&d_rigid_trans_vel_new[struct_no][0], NDIM));
+        }
+    }
+    fused_sum_reduction(reduction_arrays);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating())
+        if (struct_is_self_translating[struct_no])
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1463,6 +1500,14 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    updateLocalNodeStructureHandles();
+
+    std::vector<bool> struct_is_self_rotating(d_no_structures);
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        struct_is_self_rotating[struct_no] = struct_param.getStructureIsSelfRotating();
+    }
 
     // Calculate rigid rotational velocity.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -1474,66 +1519,55 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double Omega_rigid[3] = { 0.0 };
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0 || !struct_is_self_rotating[location_struct_handle]) continue;
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U = &U_interp_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
+            std::vector<double>& Omega_rigid = d_rigid_rot_vel_new[location_struct_handle];
 #if (NDIM == 2)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
 
 #if (NDIM == 3)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-                    Omega_rigid[0] += y * U[2] - z * U[1];
-                    Omega_rigid[1] += -x * U[2] + z * U[0];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+            Omega_rigid[0] += y * U[2] - z * U[1];
+            Omega_rigid[1] += -x * U[2] + z * U[0];
+            Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
-                }
-            }
-            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
-        } // all structs
+        }
         d_l_data_U_interp[ln]->restoreArrays();
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::pair<double*, int> > reduction_arrays;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
+        if (struct_is_self_rotating[struct_no])
+        {
+            reduction_arrays.push_back(std::make_pair(&d_rigid_rot_vel_new[struct_no][0], 3));
+        }
+    }
+    fused_sum_reduction(reduction_arrays);
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        if (struct_is_self_rotating[struct_no])
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
 
 #if (NDIM == 3)
+            const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
             solveSystemOfEqns(d_rigid_rot_vel_new[struct_no], d_moment_of_inertia_new[struct_no]);
             Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
             for (int d = 0; d < NDIM; ++d)
@@ -2129,6 +2163,18 @@ ConstraintIBMethod::midpointStep(double current_time, double new_time)
 
 } // midpointStep
 
+void
+ConstraintIBMethod::multirateStep(const double /*current_time*/,
+                                 const double /*new_time*/,
+                                 const int /*num_substeps*/,
+                                 const bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR(d_object_name << "::multirateStep():\n"
+                             << "  multirate time stepping not supported by class ConstraintIBMethod;\n"
+                             << "  use num_structure_substeps = 1 instead.\n");
+    return;
+} // multirateStep
+
 void
 ConstraintIBMethod::copyFluidVariable(int copy_from_idx, int copy_to_idx)
 {
@@ -2251,6 +2297,7 @@ ConstraintIBMethod::calculateDrag()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
+    updateLocalNodeStructureHandles();
 
     std::vector<std::vector<double> > inertia_force(d_no_structures, std::vector<double>(3, 0.0));
     std::vector<std::vector<double> > constraint_force(d_no_structures, std::vector<double>(3, 0.0));
@@ -2265,48 +2312,38 @@ ConstraintIBMethod::calculateDrag()
 
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0) continue;
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U_new = &U_new_data[local_idx][0];
+            const double* const U_current = &U_current_data[local_idx][0];
+            const double* const U_correction = &U_correction_data[local_idx][0];
 
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+            for (int d = 0; d < NDIM; ++d)
             {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_force[location_struct_handle][d] += U_new[d] - U_current[d];
-                        constraint_force[location_struct_handle][d] += U_correction[d];
-                    }
-                }
+                inertia_force[location_struct_handle][d] += U_new[d] - U_current[d];
+                constraint_force[location_struct_handle][d] += U_correction[d];
             }
-        } // all structs
+        }
         d_l_data_U_new[ln]->restoreArrays();
         d_l_data_U_current[ln]->restoreArrays();
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_arrays.push_back(std::make_pair(&inertia_force[struct_no][0], 3));
+        reduction_arrays.push_back(std::make_pair(&constraint_force[struct_no][0], 3));
+    }
+    fused_sum_reduction(reduction_arrays);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2334,6 +2371,7 @@ ConstraintIBMethod::calculateTorque()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
+    updateLocalNodeStructureHandles();
 
     std::vector<std::vector<double> > inertia_torque(d_no_structures, std::vector<double>(3, 0.0));
     std::vector<std::vector<double> > constraint_torque(d_no_structures, std::vector<double>(3, 0.0));
@@ -2350,73 +2388,64 @@ ConstraintIBMethod::calculateTorque()
 
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-            {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0) continue;
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U_new = &U_new_data[local_idx][0];
+            const double* const U_current = &U_current_data[local_idx][0];
+            const double* const U_correction = &U_correction_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
+            double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
+            R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+            double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
 
-                    R_cross_U_inertia[0] = (y * (U_new[2] - U_current[2]) - z * (U_new[1] - U_current[1]));
+            R_cross_U_inertia[0] = (y * (U_new[2] - U_current[2]) - z * (U_new[1] - U_current[1]));
 
-                    R_cross_U_inertia[1] = (-x * (U_new[2] - U_current[2]) + z * (U_new[0] - U_current[0]));
+            R_cross_U_inertia[1] = (-x * (U_new[2] - U_current[2]) + z * (U_new[0] - U_current[0]));
 
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
+            R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
 
-                    R_cross_U_constraint[0] = (y * (U_correction[2]) - z * (U_correction[1]));
+            R_cross_U_constraint[0] = (y * (U_correction[2]) - z * (U_correction[1]));
 
-                    R_cross_U_constraint[1] = (-x * (U_correction[2]) + z * (U_correction[0]));
+            R_cross_U_constraint[1] = (-x * (U_correction[2]) + z * (U_correction[0]));
 
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
+            R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
 #endif
 
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_torque[location_struct_handle][d] += R_cross_U_inertia[d];
-                        constraint_torque[location_struct_handle][d] += R_cross_U_constraint[d];
-                    }
-                }
+            for (int d = 0; d < NDIM; ++d)
+            {
+                inertia_torque[location_struct_handle][d] += R_cross_U_inertia[d];
+                constraint_torque[location_struct_handle][d] += R_cross_U_constraint[d];
             }
-        } // all structs
+        }
         d_l_data_U_new[ln]->restoreArrays();
         d_l_data_U_current[ln]->restoreArrays();
         d_l_data_U_correction[ln]->restoreArrays();
+        d_X_new_data[ln]->restoreArrays();
+    }
+
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_arrays.push_back(std::make_pair(&inertia_torque[struct_no][0], 3));
+        reduction_arrays.push_back(std::make_pair(&constraint_torque[struct_no][0], 3));
     }
+    fused_sum_reduction(reduction_arrays);
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2444,6 +2473,7 @@ ConstraintIBMethod::calculatePower()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
+    updateLocalNodeStructureHandles();
 
     std::vector<std::vector<double> > inertia_power(d_no_structures, std::vector<double>(3, 0.0));
     std::vector<std::vector<double> > constraint_power(d_no_structures, std::vector<double>(3, 0.0));
@@ -2458,48 +2488,38 @@ ConstraintIBMethod::calculatePower()
 
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int>& struct_handles = d_local_node_struct_handles[ln];
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = struct_handles[k];
+            if (location_struct_handle < 0) continue;
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U_new = &U_new_data[local_idx][0];
+            const double* const U_current = &U_current_data[local_idx][0];
+            const double* const U_correction = &U_correction_data[local_idx][0];
 
-            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+            for (int d = 0; d < NDIM; ++d)
             {
-                const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_power[location_struct_handle][d] += (U_new[d] - U_current[d]) * U_new[d];
-                        constraint_power[location_struct_handle][d] += U_correction[d] * U_new[d];
-                    }
-                }
+                inertia_power[location_struct_handle][d] += (U_new[d] - U_current[d]) * U_new[d];
+                constraint_power[location_struct_handle][d] += U_correction[d] * U_new[d];
             }
-        } // all structs
+        }
         d_l_data_U_new[ln]->restoreArrays();
         d_l_data_U_current[ln]->restoreArrays();
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::pair<double*, int> > reduction_arrays;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction_arrays.push_back(std::make_pair(&inertia_power[struct_no][0], 3));
+        reduction_arrays.push_back(std::make_pair(&constraint_power[struct_no][0], 3));
+    }
+    fused_sum_reduction(reduction_arrays);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
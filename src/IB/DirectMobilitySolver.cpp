@@ -99,6 +99,21 @@ void dsyevr_(const char* jobz,
              int* iwork,
              const int& liwork,
              int& info);
+
+// BLAS function to compute matrix-matrix products.
+void dgemm_(const char* transa,
+            const char* transb,
+            const int& m,
+            const int& n,
+            const int& k,
+            const double& alpha,
+            const double* a,
+            const int& lda,
+            const double* b,
+            const int& ldb,
+            const double& beta,
+            double* c,
+            const int& ldc);
 }
 
 namespace IBAMR
@@ -127,6 +142,7 @@ DirectMobilitySolver::DirectMobilitySolver(const std::string& object_name,
     // Some default values
     d_is_initialized = false;
     d_recompute_mob_mat = false;
+    d_reuse_body_frame_mob_mat = false;
     d_f_periodic_corr = 0.0;
 
     // Get from input
@@ -249,6 +265,10 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_ipiv_map[mat_name] = std::make_pair<int*, int*>(NULL, NULL);
     d_petsc_mat_map[mat_name] = std::make_pair<Mat, Mat>(NULL, NULL);
     d_petsc_geometric_mat_map[mat_name] = NULL;
+    d_mat_body_frame_map[mat_name] =
+        !d_recompute_mob_mat || mat_type == READ_FROM_FILE ||
+        (d_reuse_body_frame_mob_mat && prototype_struct_ids.size() == 1 && mat_type != EMPIRICAL);
+    d_mat_factorized_map[mat_name] = false;
 
     // Allocate the actual matrices.
     const int mobility_mat_size = num_nodes * NDIM;
@@ -365,32 +385,42 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool body_frame = d_mat_body_frame_map[mat_name];
 
+        if (num_structs == 0) continue;
+
+        // Gather the right-hand sides of all structures that share this
+        // mobility matrix and solve for them simultaneously.
+        double* rhs = NULL;
+        if (rank == managing_proc) rhs = new double[mat_size * num_structs];
         for (int k = 0; k < num_structs; ++k)
         {
-            double* rhs = NULL;
-            if (rank == managing_proc) rhs = new double[mat_size];
-            d_cib_strategy->copyVecToArray(b, rhs, struct_ids[k], data_depth, managing_proc);
-            if (!d_recompute_mob_mat)
+            double* rhs_k = (rank == managing_proc) ? &rhs[k * mat_size] : NULL;
+            d_cib_strategy->copyVecToArray(b, rhs_k, struct_ids[k], data_depth, managing_proc);
+            if (body_frame)
             {
-                d_cib_strategy->rotateArray(rhs,
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ true,
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs);
-            if (!d_recompute_mob_mat)
+        }
+        if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs, num_structs);
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* rhs_k = (rank == managing_proc) ? &rhs[k * mat_size] : NULL;
+            if (body_frame)
             {
-                d_cib_strategy->rotateArray(rhs,
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ false,
                                             managing_proc,
                                             data_depth);
             }
-            d_cib_strategy->copyArrayToVec(x, rhs, struct_ids[k], data_depth, managing_proc);
-            delete[] rhs;
+            d_cib_strategy->copyArrayToVec(x, rhs_k, struct_ids[k], data_depth, managing_proc);
         }
+        delete[] rhs;
     }
 
     IBAMR_TIMER_STOP(t_solve_system);
@@ -421,32 +451,42 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int mat_size = d_mat_parts_map[mat_name] * data_depth;
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool body_frame = d_mat_body_frame_map[mat_name];
 
+        if (num_structs == 0) continue;
+
+        // Gather the right-hand sides of all structures that share this body
+        // mobility matrix and solve for them simultaneously.
+        double* rhs = NULL;
+        if (rank == managing_proc) rhs = new double[mat_size * num_structs];
         for (int k = 0; k < num_structs; ++k)
         {
-            double* rhs = NULL;
-            if (rank == managing_proc) rhs = new double[mat_size];
-            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs, struct_ids[k], managing_proc);
-            if (!d_recompute_mob_mat)
+            double* rhs_k = (rank == managing_proc) ? &rhs[k * mat_size] : NULL;
+            d_cib_strategy->copyFreeDOFsVecToArray(b, rhs_k, struct_ids[k], managing_proc);
+            if (body_frame)
             {
-                d_cib_strategy->rotateArray(rhs,
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ true,
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second, rhs);
-            if (!d_recompute_mob_mat)
+        }
+        if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second, rhs, num_structs);
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* rhs_k = (rank == managing_proc) ? &rhs[k * mat_size] : NULL;
+            if (body_frame)
             {
-                d_cib_strategy->rotateArray(rhs,
+                d_cib_strategy->rotateArray(rhs_k,
                                             struct_ids[k],
                                             /*use_transpose*/ false,
                                             managing_proc,
                                             data_depth);
             }
-            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs, struct_ids[k], managing_proc);
-            delete[] rhs;
+            d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs_k, struct_ids[k], managing_proc);
         }
+        delete[] rhs;
     }
 
     IBAMR_TIMER_STOP(t_solve_body_system);
@@ -462,13 +502,22 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
     IBAMR_TIMER_START(t_initialize_solver_state);
 
     int rank = SAMRAI_MPI::getRank();
-    unsigned managed_mats = static_cast<unsigned>(d_mat_map.size());
 
-    static bool recreate_mobility_matrices = true;
-    static std::vector<bool> read_files(managed_mats, false);
-    bool initial_time = !d_recompute_mob_mat;
+    // Determine which matrices need to be (re)constructed.  Matrices that are
+    // formed in the body frame of reference are constructed only once.
+    std::vector<std::string> update_mat_names;
+    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
+         it != d_petsc_mat_map.end();
+         ++it)
+    {
+        const std::string& mat_name = it->first;
+        if (!d_mat_factorized_map[mat_name] || !d_mat_body_frame_map[mat_name])
+        {
+            update_mat_names.push_back(mat_name);
+        }
+    }
 
-    if (recreate_mobility_matrices)
+    if (!update_mat_names.empty())
     {
         // Get grid-info
         Vec* vx;
@@ -491,20 +540,18 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             domain_extents[d] = X_upper[d] - X_lower[d];
         }
 
-        int file_counter = 0;
-        for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-             it != d_petsc_mat_map.end();
-             ++it, ++file_counter)
+        for (unsigned k = 0; k < update_mat_names.size(); ++k)
         {
-            const std::string& mat_name = it->first;
+            const std::string& mat_name = update_mat_names[k];
             Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
             Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
             const MobilityMatrixType& mat_type = d_mat_type_map[mat_name];
             const std::vector<unsigned>& struct_ids = d_mat_prototype_id_map[mat_name];
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
+            const bool initial_time = d_mat_body_frame_map[mat_name];
 
-            if (mat_type == READ_FROM_FILE && !read_files[file_counter])
+            if (mat_type == READ_FROM_FILE)
             {
                 // Get the matrix from file.
                 const std::string& filename = d_mat_filename_map[mat_name];
@@ -515,8 +562,6 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
                     MatLoad(mobility_mat, binary_viewer);
                     PetscViewerDestroy(&binary_viewer);
                 }
-
-                read_files[file_counter] = true;
             }
             else
             {
@@ -537,14 +582,16 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             // Construct the geometric matrix that maps rigid body velocity to
             // nodal velocity.
             d_cib_strategy->constructGeometricMatrix(mat_name, geometric_mat, struct_ids, initial_time, managing_proc);
+
+            // Factorize the matrices.
+            factorizeMobilityMatrix(mat_name);
+            constructBodyMobilityMatrix(mat_name);
+            factorizeBodyMobilityMatrix(mat_name);
+            d_mat_factorized_map[mat_name] = true;
         }
-        factorizeMobilityMatrix();
-        constructBodyMobilityMatrix();
-        factorizeBodyMobilityMatrix();
     }
 
     d_is_initialized = true;
-    recreate_mobility_matrices = d_recompute_mob_mat;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
 
@@ -595,95 +642,76 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_reuse_body_frame_mob_mat = input_db->getBoolWithDefault("reuse_body_frame_mob_mat", d_reuse_body_frame_mob_mat);
 
     return;
 } // getFromInput
 
 void
-DirectMobilitySolver::factorizeMobilityMatrix()
+DirectMobilitySolver::factorizeMobilityMatrix(const std::string& mat_name)
 {
     int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        Mat& mat = d_petsc_mat_map[mat_name].first;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
-        const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
-    }
+    Mat& mat = d_petsc_mat_map[mat_name].first;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+    const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first, mat_name, "Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
     return;
 
 } // factorizeMobilityMatrix
 
 void
-DirectMobilitySolver::constructBodyMobilityMatrix()
+DirectMobilitySolver::constructBodyMobilityMatrix(const std::string& mat_name)
 {
     int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        const int row_size = d_mat_nodes_map[mat_name] * NDIM;
-        const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
-        const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
+    const int row_size = d_mat_nodes_map[mat_name] * NDIM;
+    const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+    const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
 
-        Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
-        Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
-        Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
+    Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
+    Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
+    Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
 
-        // Allocate a temporary matrix that holds the Matrix-Matrix product.
-        // Here we are multiplying inverse of mobility matrix with geometric matrix.
-        double* product_mat_data = new double[row_size * col_size];
-        Mat product_mat;
-        MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
-        MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
+    // Allocate a temporary matrix that holds the Matrix-Matrix product.
+    // Here we are multiplying inverse of mobility matrix with geometric matrix.
+    double* product_mat_data = new double[row_size * col_size];
+    Mat product_mat;
+    MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
+    MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
-        MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
+    // Solve for all columns of the geometric matrix simultaneously.
+    double* col_data;
+    MatDenseGetArray(product_mat, &col_data);
+    computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, col_data, col_size);
+    MatDenseRestoreArray(product_mat, &col_data);
+    MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
-        MatDestroy(&product_mat);
-        delete[] product_mat_data;
-    }
+    MatDestroy(&product_mat);
+    delete[] product_mat_data;
 
     return;
 } // generateBodyFrictionMatrix
 
 void
-DirectMobilitySolver::factorizeBodyMobilityMatrix()
+DirectMobilitySolver::factorizeBodyMobilityMatrix(const std::string& mat_name)
 {
     int rank = SAMRAI_MPI::getRank();
-    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
-         it != d_petsc_mat_map.end();
-         ++it)
-    {
-        const std::string& mat_name = it->first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+    if (rank != d_mat_proc_map[mat_name]) return;
 
-        Mat& mat = d_petsc_mat_map[mat_name].second;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
-        const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+    Mat& mat = d_petsc_mat_map[mat_name].second;
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
+    const int mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
 
-        double* mat_data = NULL;
-        MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
-        MatDenseRestoreArray(mat, &mat_data);
-    }
+    double* mat_data = NULL;
+    MatDenseGetArray(mat, &mat_data);
+    factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second, mat_name, "Body Mobility");
+    MatDenseRestoreArray(mat, &mat_data);
     return;
 
 } // factorizeBodyMobilityMatrix
@@ -858,7 +886,11 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const int num_rhs)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -869,7 +901,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
+        dpotrs_((char*)"L", mat_size, num_rhs, mat_data, mat_size, rhs, mat_size, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
@@ -880,7 +912,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        dgetrs_((char*)"N", mat_size, num_rhs, mat_data, mat_size, ipiv, rhs, mat_size, err);
 
         if (err)
         {
@@ -892,24 +924,35 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_SVD)
     {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
-        {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
-            }
-        }
-
-        for (int i = 0; i < mat_size; ++i)
-        {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
-            }
-        }
+        // The factorized matrix stores Z W^(-1/2), so that the solution is
+        // given by (Z W^(-1/2)) (Z W^(-1/2))^T rhs.
+        std::vector<double> temp(mat_size * num_rhs);
+        dgemm_((char*)"T",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               rhs,
+               mat_size,
+               0.0,
+               &temp[0],
+               mat_size);
+        dgemm_((char*)"N",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               &temp[0],
+               mat_size,
+               0.0,
+               rhs,
+               mat_size);
     }
     else
     {
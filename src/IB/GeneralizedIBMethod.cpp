@@ -457,6 +457,18 @@ GeneralizedIBMethod::trapezoidalStep(const double current_time, const double new
     return;
 } // trapezoidalStep
 
+void
+GeneralizedIBMethod::multirateStep(const double /*current_time*/,
+                                  const double /*new_time*/,
+                                  const int /*num_substeps*/,
+                                  const bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR(d_object_name << "::multirateStep():\n"
+                             << "  multirate time stepping not supported by class GeneralizedIBMethod;\n"
+                             << "  use num_structure_substeps = 1 instead.\n");
+    return;
+} // multirateStep
+
 void
 GeneralizedIBMethod::computeLagrangianForce(const double data_time)
 {
@@ -101,12 +101,22 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(const std::string&
 {
     // Set default configuration options.
     d_use_structure_predictor = true;
+    d_num_structure_substeps = 1;
 
     // Set options from input.
     if (input_db)
     {
         if (input_db->keyExists("use_structure_predictor"))
             d_use_structure_predictor = input_db->getBool("use_structure_predictor");
+        if (input_db->keyExists("num_structure_substeps"))
+            d_num_structure_substeps = input_db->getInteger("num_structure_substeps");
+    }
+    if (d_num_structure_substeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::IBExplicitHierarchyIntegrator():\n"
+                                 << "  num_structure_substeps = "
+                                 << d_num_structure_substeps
+                                 << " but num_structure_substeps must be positive.\n");
     }
 
     // Initialize object with data read from the input and restart databases.
@@ -168,35 +178,43 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
-    switch (d_time_stepping_type)
+    //
+    // NOTE: When using multirate time stepping, the Lagrangian forces are
+    // computed by IBStrategy::multirateStep() in integrateHierarchy().
+    if (d_num_structure_substeps == 1)
     {
-    case FORWARD_EULER:
-    case BACKWARD_EULER:
-    case TRAPEZOIDAL_RULE:
-        if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(current_time);
-        if (d_enable_logging)
-            plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
-                                     "to the Eulerian grid\n";
-        d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
-        d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
-        d_u_phys_bdry_op->setHomogeneousBc(true);
-        d_ib_method_ops->spreadForce(
-            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
-        d_u_phys_bdry_op->setHomogeneousBc(false);
-        if (d_f_current_idx != -1) d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
-        break;
-    case MIDPOINT_RULE:
-        // intentionally blank
-        break;
-    default:
-        TBOX_ERROR(
-            d_object_name
-            << "::preprocessIntegrateHierarchy():\n"
-            << "  unsupported time stepping type: "
-            << enum_to_string<TimeSteppingType>(d_time_stepping_type)
-            << "\n"
-            << "  supported time stepping types are: FORWARD_EULER, BACKWARD_EULER, MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
+        switch (d_time_stepping_type)
+        {
+        case FORWARD_EULER:
+        case BACKWARD_EULER:
+        case TRAPEZOIDAL_RULE:
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+            d_ib_method_ops->computeLagrangianForce(current_time);
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
+                                         "to the Eulerian grid\n";
+            d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
+            d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+            d_u_phys_bdry_op->setHomogeneousBc(true);
+            d_ib_method_ops->spreadForce(
+                d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+            d_u_phys_bdry_op->setHomogeneousBc(false);
+            if (d_f_current_idx != -1) d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
+            break;
+        case MIDPOINT_RULE:
+            // intentionally blank
+            break;
+        default:
+            TBOX_ERROR(
+                d_object_name
+                << "::preprocessIntegrateHierarchy():\n"
+                << "  unsupported time stepping type: "
+                << enum_to_string<TimeSteppingType>(d_time_stepping_type)
+                << "\n"
+                << "  supported time stepping types are: FORWARD_EULER, BACKWARD_EULER, MIDPOINT_RULE, "
+                   "TRAPEZOIDAL_RULE\n");
+        }
     }
 
     // Compute an initial prediction of the updated positions of the Lagrangian
@@ -204,7 +222,7 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     //
     // NOTE: The velocity should already have been interpolated to the
     // curvilinear mesh and should not need to be re-interpolated.
-    if (d_use_structure_predictor)
+    if (d_use_structure_predictor && d_num_structure_substeps == 1)
     {
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): performing Lagrangian forward Euler step\n";
@@ -230,49 +248,71 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                                                d_ins_hier_integrator->getNewContext());
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
-    switch (d_time_stepping_type)
+    if (d_num_structure_substeps > 1)
     {
-    case FORWARD_EULER:
-    case BACKWARD_EULER:
-        // intentionally blank
-        break;
-    case MIDPOINT_RULE:
-        if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-        d_ib_method_ops->computeLagrangianForce(half_time);
         if (d_enable_logging)
-            plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
+            plog << d_object_name << "::integrateHierarchy(): performing Lagrangian multirate step with "
+                 << d_num_structure_substeps << " substeps\n";
+        d_ib_method_ops->multirateStep(
+            current_time, new_time, d_num_structure_substeps, /*interpolate_velocity*/ cycle_num > 0);
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): spreading time-averaged Lagrangian force to the "
+                                     "Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_u_phys_bdry_op->setHomogeneousBc(true);
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
         d_u_phys_bdry_op->setHomogeneousBc(false);
-        break;
-    case TRAPEZOIDAL_RULE:
-        if (d_use_structure_predictor || cycle_num > 0)
+    }
+    else
+    {
+        switch (d_time_stepping_type)
         {
-            // NOTE: We do not re-compute the force unless it could have changed.
+        case FORWARD_EULER:
+        case BACKWARD_EULER:
+            // intentionally blank
+            break;
+        case MIDPOINT_RULE:
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
-            d_ib_method_ops->computeLagrangianForce(new_time);
+            d_ib_method_ops->computeLagrangianForce(half_time);
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
             d_u_phys_bdry_op->setHomogeneousBc(true);
             d_ib_method_ops->spreadForce(
-                d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+                d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
             d_u_phys_bdry_op->setHomogeneousBc(false);
-            d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
+            break;
+        case TRAPEZOIDAL_RULE:
+            if (d_use_structure_predictor || cycle_num > 0)
+            {
+                // NOTE: We do not re-compute the force unless it could have changed.
+                if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+                d_ib_method_ops->computeLagrangianForce(new_time);
+                if (d_enable_logging)
+                    plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the "
+                                             "Eulerian grid\n";
+                d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
+                d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+                d_u_phys_bdry_op->setHomogeneousBc(true);
+                d_ib_method_ops->spreadForce(
+                    d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+                d_u_phys_bdry_op->setHomogeneousBc(false);
+                d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
+            }
+            break;
+        default:
+            TBOX_ERROR(
+                d_object_name
+                << "::integrateHierarchy():\n"
+                << "  unsupported time stepping type: "
+                << enum_to_string<TimeSteppingType>(d_time_stepping_type)
+                << "\n"
+                << "  supported time stepping types are: FORWARD_EULER, BACKWARD_EULER, MIDPOINT_RULE, "
+                   "TRAPEZOIDAL_RULE\n");
         }
-        break;
-    default:
-        TBOX_ERROR(
-            d_object_name
-            << "::integrateHierarchy():\n"
-            << "  unsupported time stepping type: "
-            << enum_to_string<TimeSteppingType>(d_time_stepping_type)
-            << "\n"
-            << "  supported time stepping types are: FORWARD_EULER, BACKWARD_EULER, MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
     }
 
     // Compute the Lagrangian source/sink strengths and spread them to the
@@ -311,7 +351,11 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
-    switch (d_time_stepping_type)
+    //
+    // NOTE: When using multirate time stepping, the updated velocity is always
+    // interpolated to the curvilinear mesh so that it may be used in the next
+    // cycle.
+    switch (d_num_structure_substeps > 1 ? TRAPEZOIDAL_RULE : d_time_stepping_type)
     {
     case FORWARD_EULER:
     case BACKWARD_EULER:
@@ -362,7 +406,14 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
 
     // Compute an updated prediction of the updated positions of the Lagrangian
     // structure.
-    if (d_current_num_cycles > 1 && d_current_cycle_num == 0)
+    //
+    // NOTE: When using multirate time stepping, the positions of the structure
+    // have already been updated by IBStrategy::multirateStep().
+    if (d_num_structure_substeps > 1)
+    {
+        // intentionally blank
+    }
+    else if (d_current_num_cycles > 1 && d_current_cycle_num == 0)
     {
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): performing Lagrangian forward-Euler step\n";
@@ -530,6 +581,39 @@ IBExplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierar
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+IBExplicitHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Discard the Lagrangian data set up for the time step, if a time step is
+    // in progress.  The Lagrangian data at the beginning of the time step are
+    // not modified until postprocessIntegrateHierarchy().
+    if (d_current_num_cycles > 0)
+    {
+        d_ib_method_ops->resetIntegrateData(d_integrator_time, d_integrator_time + d_current_dt, d_current_num_cycles);
+    }
+
+    // Deallocate Eulerian scratch data.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_u_idx)) level->deallocatePatchData(d_u_idx);
+        if (level->checkAllocated(d_f_idx)) level->deallocatePatchData(d_f_idx);
+        if (d_f_current_idx != -1 && level->checkAllocated(d_f_current_idx))
+            level->deallocatePatchData(d_f_current_idx);
+        if (d_ib_method_ops->hasFluidSources())
+        {
+            if (level->checkAllocated(d_p_idx)) level->deallocatePatchData(d_p_idx);
+            if (level->checkAllocated(d_q_idx)) level->deallocatePatchData(d_q_idx);
+        }
+    }
+
+    IBHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized();
+    return;
+} // resetIntegratorToPreadvanceStateSpecialized
+
 void
 IBExplicitHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 {
@@ -193,6 +193,31 @@ has_physical_bdry(const Elem* elem, const BoundaryInfo& boundary_info, const Dof
     return has_physical_bdry;
 }
 
+inline void
+compute_PK1_stress(TensorValue<double>& PP,
+                   const TensorValue<double>& FF,
+                   const libMesh::Point& X,
+                   const libMesh::Point& s,
+                   Elem* const elem,
+                   const IBFEMethod::PK1StressFcnData& fcn_data,
+                   const std::vector<NumericVector<double>*>& system_data,
+                   const double data_time)
+{
+    if (fcn_data.fcn)
+    {
+        fcn_data.fcn(PP, FF, X, s, elem, system_data, data_time, fcn_data.ctx);
+    }
+    else
+    {
+        // Evaluate a batched stress function at a single point.
+        std::vector<TensorValue<double> > PP_batch(1), FF_batch(1, FF);
+        std::vector<libMesh::Point> X_batch(1, X), s_batch(1, s);
+        fcn_data.batch_fcn(PP_batch, FF_batch, X_batch, s_batch, elem, system_data, data_time, fcn_data.ctx);
+        PP = PP_batch[0];
+    }
+    return;
+} // compute_PK1_stress
+
 std::string
 libmesh_restart_file_name(const std::string& restart_dump_dirname,
                           unsigned int time_step_number,
@@ -301,10 +326,23 @@ IBFEMethod::registerPK1StressFunction(PK1StressFcnPtr fcn,
     return;
 } // registerPK1StressFunction
 
+void
+IBFEMethod::registerPK1StressFunction(PK1StressBatchFcnPtr batch_fcn,
+                                      const std::vector<unsigned int>& systems,
+                                      void* ctx,
+                                      QuadratureType quad_type,
+                                      Order quad_order,
+                                      const unsigned int part)
+{
+    registerPK1StressFunction(PK1StressFcnData(batch_fcn, systems, ctx, quad_type, quad_order), part);
+    return;
+} // registerPK1StressFunction
+
 void
 IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsigned int part)
 {
     TBOX_ASSERT(part < d_num_parts);
+    TBOX_ASSERT(!(data.fcn && data.batch_fcn));
     d_PK1_stress_fcn_data[part].push_back(data);
     if (data.quad_type == INVALID_Q_RULE)
     {
@@ -524,6 +562,48 @@ IBFEMethod::postprocessIntegrateData(double /*current_time*/, double /*new_time*
     return;
 } // postprocessIntegrateData
 
+void
+IBFEMethod::resetIntegrateData(double /*current_time*/, double /*new_time*/, int /*num_cycles*/)
+{
+    for (unsigned part = 0; part < d_num_parts; ++part)
+    {
+        // Deallocate Lagrangian scratch data.
+        delete d_X_new_vecs[part];
+        delete d_X_half_vecs[part];
+        delete d_U_new_vecs[part];
+        delete d_U_half_vecs[part];
+
+        // The solution vectors are only updated by postprocessIntegrateData(),
+        // and so they still contain the data at the beginning of the time
+        // step.  Restore the local copies, which may have been modified during
+        // the time step.
+        d_X_systems[part]->solution->localize(*d_X_systems[part]->current_local_solution);
+        d_U_systems[part]->solution->localize(*d_U_systems[part]->current_local_solution);
+        d_F_systems[part]->solution->localize(*d_F_systems[part]->current_local_solution);
+    }
+
+    d_X_systems.clear();
+    d_X_current_vecs.clear();
+    d_X_new_vecs.clear();
+    d_X_half_vecs.clear();
+    d_X_IB_ghost_vecs.clear();
+
+    d_U_systems.clear();
+    d_U_current_vecs.clear();
+    d_U_new_vecs.clear();
+    d_U_half_vecs.clear();
+
+    d_F_systems.clear();
+    d_F_half_vecs.clear();
+    d_F_IB_ghost_vecs.clear();
+
+    // Reset the current time step interval.
+    d_current_time = std::numeric_limits<double>::quiet_NaN();
+    d_new_time = std::numeric_limits<double>::quiet_NaN();
+    d_half_time = std::numeric_limits<double>::quiet_NaN();
+    return;
+} // resetIntegrateData
+
 void
 IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<CoarsenSchedule<NDIM> > >& /*u_synch_scheds*/,
@@ -614,6 +694,67 @@ IBFEMethod::trapezoidalStep(const double current_time, const double new_time)
     return;
 } // trapezoidalStep
 
+void
+IBFEMethod::multirateStep(const double current_time,
+                          const double new_time,
+                          const int num_substeps,
+                          const bool interpolate_velocity)
+{
+    TBOX_ASSERT(num_substeps > 0);
+    const double dt = new_time - current_time;
+    const double dt_sub = dt / static_cast<double>(num_substeps);
+    int ierr;
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        PetscVector<double>* X_sub_vec = dynamic_cast<PetscVector<double>*>(
+            d_X_current_vecs[part]->clone().release()); // WARNING: must be manually deleted
+        PetscVector<double>* X_mid_vec = dynamic_cast<PetscVector<double>*>(
+            d_X_current_vecs[part]->clone().release()); // WARNING: must be manually deleted
+        PetscVector<double>* U_sub_vec = dynamic_cast<PetscVector<double>*>(
+            d_U_current_vecs[part]->clone().release()); // WARNING: must be manually deleted
+        PetscVector<double>* F_sub_vec = dynamic_cast<PetscVector<double>*>(
+            d_F_half_vecs[part]->clone().release()); // WARNING: must be manually deleted
+        d_F_half_vecs[part]->zero();
+        for (int k = 0; k < num_substeps; ++k)
+        {
+            // Determine the structure velocity over the substep.
+            const double substep_half_time = current_time + (static_cast<double>(k) + 0.5) * dt_sub;
+            if (interpolate_velocity)
+            {
+                const double w = (substep_half_time - current_time) / dt;
+                ierr = VecAXPBYPCZ(
+                    U_sub_vec->vec(), 1.0 - w, w, 0.0, d_U_current_vecs[part]->vec(), d_U_new_vecs[part]->vec());
+                IBTK_CHKERRQ(ierr);
+            }
+
+            // Accumulate the force evaluated at the midpoint of the substep.
+            ierr = VecWAXPY(X_mid_vec->vec(), 0.5 * dt_sub, U_sub_vec->vec(), X_sub_vec->vec());
+            IBTK_CHKERRQ(ierr);
+            X_mid_vec->close();
+            computeInteriorForceDensity(*F_sub_vec, *X_mid_vec, substep_half_time, part);
+            ierr = VecAXPY(d_F_half_vecs[part]->vec(), 1.0 / static_cast<double>(num_substeps), F_sub_vec->vec());
+            IBTK_CHKERRQ(ierr);
+
+            // Advance the structure over the substep.
+            ierr = VecAXPY(X_sub_vec->vec(), dt_sub, U_sub_vec->vec());
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecCopy(X_sub_vec->vec(), d_X_new_vecs[part]->vec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAXPBYPCZ(
+            d_X_half_vecs[part]->vec(), 0.5, 0.5, 0.0, d_X_current_vecs[part]->vec(), d_X_new_vecs[part]->vec());
+        IBTK_CHKERRQ(ierr);
+        d_X_new_vecs[part]->close();
+        d_X_half_vecs[part]->close();
+        d_F_half_vecs[part]->close();
+        delete X_sub_vec;
+        delete X_mid_vec;
+        delete U_sub_vec;
+        delete F_sub_vec;
+    }
+    return;
+} // multirateStep
+
 void
 IBFEMethod::computeLagrangianForce(const double data_time)
 {
@@ -992,7 +1133,8 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     // First handle the stress contributions.
     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!fcn_data.fcn && !fcn_data.batch_fcn) continue;
 
         AutoPtr<QBase> qrule =
             QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
@@ -1040,6 +1182,8 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         VectorValue<double> F, F_qp, n;
         libMesh::Point X_qp;
         boost::multi_array<double, 2> X_node;
+        std::vector<TensorValue<double> > PP_elem, FF_elem;
+        std::vector<libMesh::Point> X_elem;
         const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
         const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
         for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
@@ -1054,20 +1198,47 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dof_indices[0].size();
             get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+
+            // Gather the deformed positions and the deformation gradients at
+            // all of the quadrature points of the element.
+            PP_elem.resize(n_qp);
+            FF_elem.resize(n_qp);
+            X_elem.resize(n_qp);
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& s_qp = q_point[qp];
-                interpolate(X_qp, qp, X_node, phi);
-                jacobian(FF, qp, X_node, dphi);
+                interpolate(X_elem[qp], qp, X_node, phi);
+                jacobian(FF_elem[qp], qp, X_node, dphi);
+            }
 
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time, d_PK1_stress_fcn_data[part][k].ctx);
+            // Compute the values of the first Piola-Kirchhoff stress tensor at
+            // the quadrature points, either with a single call to the batched
+            // stress function or one point at a time.
+            if (fcn_data.batch_fcn)
+            {
+                fcn_data.batch_fcn(
+                    PP_elem, FF_elem, X_elem, q_point, elem, PK1_stress_fcn_data[k], data_time, fcn_data.ctx);
+            }
+            else
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    fcn_data.fcn(PP_elem[qp],
+                                 FF_elem[qp],
+                                 X_elem[qp],
+                                 q_point[qp],
+                                 elem,
+                                 PK1_stress_fcn_data[k],
+                                 data_time,
+                                 fcn_data.ctx);
+                }
+            }
+
+            // Add the corresponding forces to the right-hand-side vector.
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
                 for (unsigned int k = 0; k < n_basis; ++k)
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
+                    F_qp = -PP_elem[qp] * dphi[k][qp] * JxW[qp];
                     for (unsigned int i = 0; i < NDIM; ++i)
                     {
                         G_rhs_e[i](k) += F_qp(i);
@@ -1102,18 +1273,8 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
-                    {
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           X_qp,
-                                                           s_qp,
-                                                           elem,
-                                                           PK1_stress_fcn_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
+                    compute_PK1_stress(PP, FF, X_qp, s_qp, elem, fcn_data, PK1_stress_fcn_data[k], data_time);
+                    F += PP * normal_face[qp];
 
                     // If we are imposing jump conditions, then we keep only the
                     // normal part of the force.  This has the effect of
@@ -1531,19 +1692,14 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        const PK1StressFcnData& fcn_data = d_PK1_stress_fcn_data[part][k];
+                        if (fcn_data.fcn || fcn_data.batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            compute_PK1_stress(
+                                PP, FF, X_qp, s_qp, elem, fcn_data, PK1_stress_fcn_data[k], data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -1919,19 +2075,14 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        const PK1StressFcnData& fcn_data = d_PK1_stress_fcn_data[part][k];
+                        if (fcn_data.fcn || fcn_data.batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            compute_PK1_stress(
+                                PP, FF, X_qp, s_qp, elem, fcn_data, PK1_stress_fcn_data[k], data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -46,6 +46,7 @@
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -57,6 +58,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "boost/array.hpp"
@@ -73,6 +75,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscvec.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -318,23 +321,21 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
-double
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// Compute the indices and weights of the cell-centered values used to linearly
+// interpolate to X, which is located in cell i_cell centered at X_cell.
+void
+build_cc_interp_stencil(std::vector<std::pair<Index<NDIM>, double> >& stencil,
+                        const Point& X,
+                        const Index<NDIM>& i_cell,
+                        const Point& X_cell,
+                        const double* const dx)
 {
+    stencil.clear();
     boost::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         is_lower[d] = X[d] < X_cell[d];
     }
-    double U = 0.0;
 #if (NDIM == 3)
     for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
     {
@@ -365,37 +366,39 @@ linear_interp(const Point& X,
                                     i_shift2 + i_cell(2)
 #endif
                                         );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
+                stencil.push_back(std::make_pair(i, wgt));
             }
         }
 #if (NDIM == 3)
     }
 #endif
-    return U;
-} // linear_interp
-
-template <int N>
-Eigen::Matrix<double, N, 1>
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+    return;
+} // build_cc_interp_stencil
+
+// Compute the indices and weights of the side-centered values in the specified
+// axis used to linearly interpolate to X, which is located in cell i_cell
+// centered at X_cell.
+void
+build_sc_interp_stencil(std::vector<std::pair<Index<NDIM>, double> >& stencil,
+                        const unsigned int axis,
+                        const Point& X,
+                        const Index<NDIM>& i_cell,
+                        const Point& X_cell,
+                        const double* const dx)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == N);
-#endif
+    stencil.clear();
     boost::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
-        is_lower[d] = X[d] < X_cell[d];
+        if (d == axis)
+        {
+            is_lower[d] = false;
+        }
+        else
+        {
+            is_lower[d] = X[d] < X_cell[d];
+        }
     }
-    Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
 #if (NDIM == 3)
     for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
     {
@@ -404,19 +407,19 @@ linear_interp(const Point& X,
         {
             for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
             {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
+                const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
+                                   X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
 #if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
+                                   ,
+                                   X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
 #endif
-                                     );
+                                   );
                 const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
+                    (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
+                     ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
 #if (NDIM == 3)
                      *
-                     ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
+                     ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
 #endif
                          );
                 const Index<NDIM> i(i_shift0 + i_cell(0),
@@ -426,88 +429,69 @@ linear_interp(const Point& X,
                                     i_shift2 + i_cell(2)
 #endif
                                         );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
+                stencil.push_back(std::make_pair(i, wgt));
             }
         }
 #if (NDIM == 3)
     }
 #endif
-    return U;
-} // linear_interp
-
-Vector
-linear_interp(const Point& X,
-              const Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const SideData<NDIM, double>& v,
-              const Index<NDIM>& /*patch_lower*/,
-              const Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+    return;
+} // build_sc_interp_stencil
+
+// Returns the number of the patch of the level that contains cell i, or -1 if
+// no patch of the level contains the cell.
+int
+find_patch_num(const Pointer<PatchLevel<NDIM> > level, const Index<NDIM>& i)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == 1);
-#endif
-    Vector U(Vector::Zero());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    Array<int> patch_nums;
+    level->getBoxTree()->findOverlapIndices(patch_nums, Box<NDIM>(i, i));
+    return (patch_nums.getSize() > 0 ? patch_nums[0] : -1);
+} // find_patch_num
+
+// Returns the local patch of the level with the given patch number and
+// computes the center of cell i, or returns a NULL pointer if the patch is not
+// local.
+Pointer<Patch<NDIM> >
+get_local_patch(const Pointer<PatchLevel<NDIM> > level, const int patch_num, const Index<NDIM>& i, Point& X_cell)
+{
+    if (!level->getProcessorMapping().isMappingLocal(patch_num)) return Pointer<Patch<NDIM> >(NULL);
+    Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+    const Index<NDIM>& patch_lower = patch->getBox().lower();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        boost::array<bool, NDIM> is_lower;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            if (d == axis)
-            {
-                is_lower[d] = false;
-            }
-            else
-            {
-                is_lower[d] = X[d] < X_cell[d];
-            }
-        }
-#if (NDIM == 3)
-        for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
+        X_cell[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+    }
+    return patch;
+} // get_local_patch
+
+// Records the boxes and the processor assignments of the patches of each
+// level of the hierarchy.
+void
+get_hierarchy_configuration(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                            std::vector<std::vector<Box<NDIM> > >& level_boxes,
+                            std::vector<std::vector<int> >& level_procs)
+{
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    level_boxes.resize(finest_ln + 1);
+    level_procs.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& mapping = level->getProcessorMapping();
+        level_boxes[ln].resize(boxes.getNumberOfBoxes());
+        level_procs[ln].resize(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
         {
-#endif
-            for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-            {
-                for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-                {
-                    const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
-                                       X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
-#if (NDIM == 3)
-                                       ,
-                                       X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
-#endif
-                                       );
-                    const double wgt =
-                        (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
-                         ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                         *
-                         ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                             );
-                    const Index<NDIM> i(i_shift0 + i_cell(0),
-                                        i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                            ,
-                                        i_shift2 + i_cell(2)
-#endif
-                                            );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
-                }
-            }
-#if (NDIM == 3)
+            level_boxes[ln][k] = boxes[k];
+            level_procs[ln][k] = mapping.getProcessorAssignment(k);
         }
-#endif
     }
-    return U;
-} // linear_interp
+    return;
+} // get_hierarchy_configuration
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -528,8 +512,8 @@ IBInstrumentPanel::IBInstrumentPanel(const std::string& object_name, Pointer<Dat
       d_flow_values(),
       d_mean_pres_values(),
       d_point_pres_values(),
-      d_web_patch_map(),
-      d_web_centroid_map(),
+      d_patch_stencils(),
+      d_web_area(),
       d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"),
       d_output_log_file(false),
       d_log_file_name(NDIM == 2 ? "inst2d.log" : "inst3d.log"),
@@ -817,6 +801,22 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         }
     }
 
+    // Reuse the interpolation stencils if neither the positions of the
+    // perimeter nodes nor the configuration of the patch hierarchy have changed
+    // since the stencils were set up.
+    std::vector<std::vector<Box<NDIM> > > level_boxes;
+    std::vector<std::vector<int> > level_procs;
+    get_hierarchy_configuration(hierarchy, level_boxes, level_procs);
+    if (X_perimeter_flattened == d_stencil_X_perimeter && level_boxes == d_stencil_level_boxes &&
+        level_procs == d_stencil_level_procs)
+    {
+        IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
+        return;
+    }
+    d_stencil_X_perimeter = X_perimeter_flattened;
+    d_stencil_level_boxes = level_boxes;
+    d_stencil_level_procs = level_procs;
+
     // Determine the centroid of each perimeter.
     std::fill(d_X_centroid.begin(), d_X_centroid.end(), Point::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
@@ -868,8 +868,8 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the interpolation stencils from the Cartesian grid data to the web
+    // patch and web centroid data.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -877,11 +877,13 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // the region of physical space in which the centroid of the web patch is
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
-    // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
+    // which the web centroid is located.  Because this assignment is
+    // determined from the global level boxes, every process computes the same
+    // total web patch area for each meter.
+    d_patch_stencils.clear();
+    d_patch_stencils.resize(finest_ln + 1);
+    d_web_area.assign(d_num_meters, 0.0);
+    std::vector<std::pair<Index<NDIM>, double> > stencil;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -909,7 +911,7 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
 
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
-            // Setup the web patch mapping.
+            // Setup the web patch stencils.
             for (unsigned int m = 0; m < d_X_web[l].shape()[0]; ++m)
             {
                 for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
@@ -923,19 +925,51 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                              finer_dx.data(),
                                                                              finer_domain_box_level_lower,
                                                                              finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    const int patch_num = find_patch_num(level, i);
+                    if (patch_num < 0 || (ln < finest_ln && find_patch_num(finer_level, finer_i) >= 0))
+                    {
+                        continue;
+                    }
+                    const Vector& dA = d_dA_web[l][m][n];
+                    const double dA_norm = dA.norm();
+                    d_web_area[l] += dA_norm;
+                    Point X_cell;
+                    Pointer<Patch<NDIM> > patch = get_local_patch(level, patch_num, i, X_cell);
+                    if (!patch) continue;
+                    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                    const double* const patch_dx = pgeom->getDx();
+                    PatchStencils& patch_stencils = d_patch_stencils[ln][patch->getPatchNumber()];
+                    StencilElement elem;
+                    elem.meter_num = l;
+                    build_cc_interp_stencil(stencil, X, i, X_cell, patch_dx);
+                    for (unsigned int k = 0; k < stencil.size(); ++k)
                     {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        elem.i = stencil[k].first;
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            elem.depth = d;
+                            elem.wgt = stencil[k].second * dA[d];
+                            patch_stencils.U_cc_flow.push_back(elem);
+                        }
+                        elem.depth = 0;
+                        elem.wgt = stencil[k].second * dA_norm;
+                        patch_stencils.P_mean.push_back(elem);
+                    }
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        build_sc_interp_stencil(stencil, axis, X, i, X_cell, patch_dx);
+                        for (unsigned int k = 0; k < stencil.size(); ++k)
+                        {
+                            elem.depth = axis;
+                            elem.i = stencil[k].first;
+                            elem.wgt = stencil[k].second * dA[axis];
+                            patch_stencils.U_sc_flow.push_back(elem);
+                        }
                     }
                 }
             }
 
-            // Setup the web centroid mapping.
+            // Setup the web centroid stencil.
             const Point& X = d_X_centroid[l];
             const Index<NDIM> i = IndexUtilities::getCellIndex(
                 X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
@@ -945,12 +979,25 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                      finer_dx.data(),
                                                                      finer_domain_box_level_lower,
                                                                      finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+            const int patch_num = find_patch_num(level, i);
+            if (patch_num < 0 || (ln < finest_ln && find_patch_num(finer_level, finer_i) >= 0))
             {
-                WebCentroid c;
-                c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                continue;
+            }
+            Point X_cell;
+            Pointer<Patch<NDIM> > patch = get_local_patch(level, patch_num, i, X_cell);
+            if (!patch) continue;
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            PatchStencils& patch_stencils = d_patch_stencils[ln][patch->getPatchNumber()];
+            StencilElement elem;
+            elem.meter_num = l;
+            elem.depth = 0;
+            build_cc_interp_stencil(stencil, X, i, X_cell, pgeom->getDx());
+            for (unsigned int k = 0; k < stencil.size(); ++k)
+            {
+                elem.i = stencil[k].first;
+                elem.wgt = stencil[k].second;
+                patch_stencils.P_point.push_back(elem);
             }
         }
     }
@@ -999,123 +1046,66 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
     std::fill(d_flow_values.begin(), d_flow_values.end(), 0.0);
     std::fill(d_mean_pres_values.begin(), d_mean_pres_values.end(), 0.0);
     std::fill(d_point_pres_values.begin(), d_point_pres_values.end(), 0.0);
-    std::vector<double> A(d_num_meters, 0.0);
 
     // Compute the local contributions to the flux of U through the flow meter,
     // the average value of P in the flow meter, and the pointwise value of P at
-    // the centroid of the meter.
+    // the centroid of the meter by applying the precomputed stencils.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
+        const std::map<int, PatchStencils>& level_stencils = d_patch_stencils[ln];
+        if (level_stencils.empty()) continue;
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (std::map<int, PatchStencils>::const_iterator cit = level_stencils.begin(); cit != level_stencils.end();
+             ++cit)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const Index<NDIM>& patch_lower = patch_box.lower();
-            const Index<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
+            Pointer<Patch<NDIM> > patch = level->getPatch(cit->first);
+            const PatchStencils& patch_stencils = cit->second;
 
             Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (U_cc_data)
             {
-                const Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_cc_data->getDepth() == NDIM);
+#endif
+                const std::vector<StencilElement>& stencil = patch_stencils.U_cc_flow;
+                for (std::vector<StencilElement>::const_iterator it = stencil.begin(); it != stencil.end(); ++it)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                    d_flow_values[it->meter_num] += (*U_cc_data)(CellIndex<NDIM>(it->i), it->depth) * it->wgt;
+                }
+            }
+            if (U_sc_data)
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_sc_data->getDepth() == 1);
 #endif
-                                           );
-                    if (U_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                const std::vector<StencilElement>& stencil = patch_stencils.U_sc_flow;
+                for (std::vector<StencilElement>::const_iterator it = stencil.begin(); it != stencil.end(); ++it)
+                {
+                    const SideIndex<NDIM> i_s(it->i, it->depth, SideIndex<NDIM>::Lower);
+                    d_flow_values[it->meter_num] += (*U_sc_data)(i_s) * it->wgt;
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            }
+            if (P_cc_data)
+            {
+                const std::vector<StencilElement>& mean_stencil = patch_stencils.P_mean;
+                for (std::vector<StencilElement>::const_iterator it = mean_stencil.begin(); it != mean_stencil.end();
+                     ++it)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (P_cc_data)
-                    {
-                        for (WebCentroidMap::const_iterator it = centroid_range.first; it != centroid_range.second;
-                             ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    d_mean_pres_values[it->meter_num] += (*P_cc_data)(CellIndex<NDIM>(it->i)) * it->wgt;
+                }
+                const std::vector<StencilElement>& point_stencil = patch_stencils.P_point;
+                for (std::vector<StencilElement>::const_iterator it = point_stencil.begin(); it != point_stencil.end();
+                     ++it)
+                {
+                    d_point_pres_values[it->meter_num] += (*P_cc_data)(CellIndex<NDIM>(it->i)) * it->wgt;
                 }
             }
         }
     }
 
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int m = 0; m < d_num_meters; ++m)
-    {
-        d_mean_pres_values[m] /= A[m];
-    }
-
     // Loop over all local nodes to determine the velocities of the local
     // perimeter nodes.
     std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
@@ -1161,26 +1151,38 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Set the velocities of all perimeter nodes on all processes.
-    std::vector<double> U_perimeter_flattened;
+    // Synchronize the meter values and the velocities of all perimeter nodes
+    // across all processes using a single reduction.
+    std::vector<double> meter_data;
+    meter_data.reserve(3 * d_num_meters);
+    meter_data.insert(meter_data.end(), d_flow_values.begin(), d_flow_values.end());
+    meter_data.insert(meter_data.end(), d_mean_pres_values.begin(), d_mean_pres_values.end());
+    meter_data.insert(meter_data.end(), d_point_pres_values.begin(), d_point_pres_values.end());
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            U_perimeter_flattened.insert(
-                U_perimeter_flattened.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
+            meter_data.insert(meter_data.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
         }
     }
-    SAMRAI_MPI::sumReduction(&U_perimeter_flattened[0], static_cast<int>(U_perimeter_flattened.size()));
-    for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
+    SAMRAI_MPI::sumReduction(&meter_data[0], static_cast<int>(meter_data.size()));
+    std::copy(&meter_data[0], &meter_data[0] + d_num_meters, d_flow_values.begin());
+    std::copy(&meter_data[d_num_meters], &meter_data[0] + 2 * d_num_meters, d_mean_pres_values.begin());
+    std::copy(&meter_data[2 * d_num_meters], &meter_data[0] + 3 * d_num_meters, d_point_pres_values.begin());
+    for (unsigned int m = 0, k = 3 * d_num_meters; m < d_num_meters; ++m)
     {
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
+        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, k += NDIM)
         {
-            std::copy(
-                &U_perimeter_flattened[NDIM * k], (&U_perimeter_flattened[NDIM * k]) + NDIM, U_perimeter[m][n].data());
+            std::copy(&meter_data[k], &meter_data[k] + NDIM, U_perimeter[m][n].data());
         }
     }
 
+    // Normalize the mean pressure.
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        d_mean_pres_values[m] /= d_web_area[m];
+    }
+
     // Determine the velocity of the centroid of each perimeter.
     std::vector<Vector> U_centroid(d_num_meters, Vector::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
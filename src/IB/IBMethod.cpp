@@ -835,6 +835,88 @@ IBMethod::trapezoidalStep(const double current_time, const double new_time)
     return;
 } // trapezoidalStep
 
+void
+IBMethod::multirateStep(const double current_time,
+                        const double new_time,
+                        const int num_substeps,
+                        const bool interpolate_velocity)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_substeps > 0);
+#endif
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double dt_sub = dt / static_cast<double>(num_substeps);
+    std::vector<Pointer<LData> > *U_current_data, *U_new_data, *F_half_data;
+    bool* F_half_needs_ghost_fill;
+    getVelocityData(&U_current_data, current_time);
+    getVelocityData(&U_new_data, new_time);
+    getForceData(&F_half_data, &F_half_needs_ghost_fill, d_half_time);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<LData> X_sub_data = d_l_data_manager->createLData("X_sub", ln, NDIM);
+        Pointer<LData> X_mid_data = d_l_data_manager->createLData("X_mid", ln, NDIM);
+        Pointer<LData> U_sub_data = d_l_data_manager->createLData("U_sub", ln, NDIM);
+        Pointer<LData> F_sub_data = d_l_data_manager->createLData("F_sub", ln, NDIM);
+        Vec X_current_vec = d_X_current_data[ln]->getVec();
+        Vec U_current_vec = (*U_current_data)[ln]->getVec();
+        Vec U_new_vec = (*U_new_data)[ln]->getVec();
+        Vec F_half_vec = (*F_half_data)[ln]->getVec();
+        Vec X_sub_vec = X_sub_data->getVec();
+        Vec X_mid_vec = X_mid_data->getVec();
+        Vec U_sub_vec = U_sub_data->getVec();
+        Vec F_sub_vec = F_sub_data->getVec();
+        ierr = VecCopy(X_current_vec, X_sub_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCopy(U_current_vec, U_sub_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSet(F_half_vec, 0.0);
+        IBTK_CHKERRQ(ierr);
+        for (int k = 0; k < num_substeps; ++k)
+        {
+            // Determine the structure velocity over the substep.
+            const double substep_half_time = current_time + (static_cast<double>(k) + 0.5) * dt_sub;
+            if (interpolate_velocity)
+            {
+                const double w = (substep_half_time - current_time) / dt;
+                ierr = VecAXPBYPCZ(U_sub_vec, 1.0 - w, w, 0.0, U_current_vec, U_new_vec);
+                IBTK_CHKERRQ(ierr);
+            }
+
+            // Accumulate the force evaluated at the midpoint of the substep.
+            ierr = VecWAXPY(X_mid_vec, 0.5 * dt_sub, U_sub_vec, X_sub_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSet(F_sub_vec, 0.0);
+            IBTK_CHKERRQ(ierr);
+            if (d_ib_force_fcn)
+            {
+                d_ib_force_fcn->computeLagrangianForce(
+                    F_sub_data, X_mid_data, U_sub_data, d_hierarchy, ln, substep_half_time, d_l_data_manager);
+            }
+            ierr = VecAXPY(F_half_vec, 1.0 / static_cast<double>(num_substeps), F_sub_vec);
+            IBTK_CHKERRQ(ierr);
+
+            // Advance the structure over the substep.
+            ierr = VecAXPY(X_sub_vec, dt_sub, U_sub_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecCopy(X_sub_vec, d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    d_X_new_needs_ghost_fill = true;
+    *F_half_needs_ghost_fill = true;
+
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    reinitMidpointData(d_X_current_data, d_X_new_data, *X_half_data);
+    *X_half_needs_ghost_fill = true;
+    return;
+} // multirateStep
+
 bool
 IBMethod::hasFluidSources() const
 {
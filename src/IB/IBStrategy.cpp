@@ -153,6 +153,13 @@ IBStrategy::postprocessIntegrateData(double /*current_time*/, double /*new_time*
     return;
 } // postprocessIntegrateData
 
+void
+IBStrategy::resetIntegrateData(double /*current_time*/, double /*new_time*/, int /*num_cycles*/)
+{
+    // intentionally blank
+    return;
+} // resetIntegrateData
+
 void
 IBStrategy::setUseFixedLEOperators(bool use_fixed_coupling_ops)
 {
@@ -174,6 +181,16 @@ IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
     return;
 } // backwardEulerStep
 
+void
+IBStrategy::multirateStep(double /*current_time*/,
+                          double /*new_time*/,
+                          int /*num_substeps*/,
+                          bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR("IBStrategy::multirateStep(): unimplemented\n");
+    return;
+} // multirateStep
+
 bool
 IBStrategy::hasFluidSources() const
 {
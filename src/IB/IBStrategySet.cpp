@@ -164,6 +164,17 @@ IBStrategySet::postprocessIntegrateData(double current_time, double new_time, in
     return;
 } // postprocessIntegrateData
 
+void
+IBStrategySet::resetIntegrateData(double current_time, double new_time, int num_cycles)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->resetIntegrateData(current_time, new_time, num_cycles);
+    }
+    return;
+} // resetIntegrateData
+
 void
 IBStrategySet::updateFixedLEOperators()
 {
@@ -222,6 +233,17 @@ IBStrategySet::trapezoidalStep(double current_time, double new_time)
     return;
 } // trapezoidalStep
 
+void
+IBStrategySet::multirateStep(double current_time, double new_time, int num_substeps, bool interpolate_velocity)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->multirateStep(current_time, new_time, num_substeps, interpolate_velocity);
+    }
+    return;
+} // multirateStep
+
 void
 IBStrategySet::computeLagrangianForce(double data_time)
 {
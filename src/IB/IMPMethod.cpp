@@ -85,8 +85,10 @@
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ParallelPatchFor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/libmesh_utilities.h"
+#include "libmesh/point.h"
 #include "libmesh/tensor_value.h"
 #include "libmesh/type_tensor.h"
 #include "libmesh/type_vector.h"
@@ -125,8 +127,8 @@ kernel(const double X,
        const int /*patch_box_upper*/,
        int& stencil_box_lower,
        int& stencil_box_upper,
-       boost::multi_array<double, 1>& phi,
-       boost::multi_array<double, 1>& dphi)
+       boost::array<double, 2 * kernel_width>& phi,
+       boost::array<double, 2 * kernel_width>& dphi)
 {
     const double X_o_dx = (X - patch_x_lower) / dx;
     stencil_box_lower = boost::math::round(X_o_dx) + patch_box_lower - kernel_width;
@@ -171,6 +173,65 @@ kernel(const double X,
     return;
 }
 
+// Collect the global PETSc indices of the local nodes so that the nodes may be
+// processed by independent loop iterations.
+void
+get_global_petsc_indices(std::vector<int>& idxs, const std::vector<LNode*>& local_nodes)
+{
+    idxs.resize(local_nodes.size());
+    for (unsigned int k = 0; k < local_nodes.size(); ++k)
+    {
+        idxs[k] = local_nodes[k]->getGlobalPETScIndex();
+    }
+    return;
+}
+
+// Set F_new = inv(I - alpha*Grad_U_new) * (I + alpha*Grad_U_current) * F_current
+// at the specified material points.  The points are distributed across threads
+// when OpenMP is enabled.
+void
+update_deformation_gradient(boost::multi_array_ref<double, 2>& F_new_array,
+                            const boost::multi_array_ref<double, 2>& F_current_array,
+                            const boost::multi_array_ref<double, 2>& Grad_U_current_array,
+                            const boost::multi_array_ref<double, 2>& Grad_U_new_array,
+                            const double alpha,
+                            const std::vector<int>& idxs)
+{
+    const int num_idxs = static_cast<int>(idxs.size());
+    IBTK_PARALLEL_FOR(k, num_idxs)
+    {
+        const int idx = idxs[k];
+        const TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
+        TensorValue<double> F_current, Grad_U_current, Grad_U_new;
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                F_current(i, j) = F_current_array[idx][NDIM * i + j];
+                Grad_U_current(i, j) = Grad_U_current_array[idx][NDIM * i + j];
+                Grad_U_new(i, j) = Grad_U_new_array[idx][NDIM * i + j];
+            }
+        }
+#if (NDIM == 2)
+        F_current(2, 2) = 1.0;
+#endif
+        const TensorValue<double> F_new =
+            tensor_inverse(I - alpha * Grad_U_new) * (I + alpha * Grad_U_current) * F_current;
+        for (int i = 0; i < NDIM; ++i)
+        {
+            for (int j = 0; j < NDIM; ++j)
+            {
+                F_new_array[idx][NDIM * i + j] = F_new(i, j);
+            }
+        }
+    }
+    return;
+}
+
+// The maximum number of material points passed to a batched PK1 stress
+// function in a single call.
+static const int PK1_STRESS_BATCH_SIZE = 1024;
+
 // Version of IMPMethod restart file data.
 static const int IMP_METHOD_VERSION = 1;
 }
@@ -191,10 +252,17 @@ IMPMethod::IMPMethod(const std::string& object_name, Pointer<Database> input_db,
     // Ensure all pointers to helper objects are NULL.
     d_l_initializer = NULL;
     d_silo_writer = NULL;
+    d_PK1_stress_fcn = NULL;
+    d_PK1_stress_fcn_ctx = NULL;
+    d_PK1_stress_batch_fcn = NULL;
+    d_PK1_stress_batch_fcn_ctx = NULL;
 
     // Set some default values.
     d_error_if_points_leave_domain = false;
     d_ghosts = LEInteractor::getMinimumGhostWidth(KERNEL_FCN);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(LEInteractor::getStencilSize(KERNEL_FCN) == 2 * kernel_width);
+#endif
     d_do_log = false;
 
     // Initialize object with data read from the input and restart databases.
@@ -472,6 +540,10 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
             }
+
+            // Collect the nodes of the patch so that they may be processed in
+            // parallel.
+            std::vector<int> local_idxs;
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
@@ -479,74 +551,81 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
                 if (!node_set) continue;
                 for (LNodeSet::iterator it = node_set->begin(); it != node_set->end(); ++it)
                 {
-                    const LNode* const node_idx = *it;
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_array[local_idx][0];
-                    VectorValue<double> U;
-                    TensorValue<double> Grad_U;
+                    local_idxs.push_back((*it)->getLocalPETScIndex());
+                }
+            }
 
-                    // Interpolate U and Grad U using a smoothed kernel
-                    // function evaluated about X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
+            // A node may be found in more than one cell of the ghost box, and
+            // so duplicate indices are removed to prevent different threads
+            // from writing to the same node.  The interpolated values depend
+            // only on the index of the node, and so this does not change the
+            // results.
+            std::sort(local_idxs.begin(), local_idxs.end());
+            local_idxs.erase(std::unique(local_idxs.begin(), local_idxs.end()), local_idxs.end());
+            const int num_local_idxs = static_cast<int>(local_idxs.size());
+            const SideData<NDIM, double>& u_sc_data = *u_data;
+            IBTK_PARALLEL_FOR(n, num_local_idxs)
+            {
+                const int local_idx = local_idxs[n];
+                const double* const X = &X_array[local_idx][0];
+                VectorValue<double> U;
+                TensorValue<double> Grad_U;
+
+                // Interpolate U and Grad U using a smoothed kernel function
+                // evaluated about X.
+                Box<NDIM> stencil_box;
+                boost::array<boost::array<double, 2 * kernel_width>, NDIM> phi, dphi;
+                for (unsigned int component = 0; component < NDIM; ++component)
+                {
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
+                        kernel(X[d],
+                               x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
+                               x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
+                               dx[d],
+                               patch_box.lower(d),
+                               patch_box.upper(d) + (d == component ? 1 : 0),
+                               stencil_box.lower(d),
+                               stencil_box.upper(d),
+                               phi[d],
+                               dphi[d]);
                     }
-                    for (unsigned int component = 0; component < NDIM; ++component)
+                    for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
                     {
+                        const Index<NDIM>& i = b();
+                        const Index<NDIM> i_shift = i - stencil_box.lower();
+                        const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
+                        const double u = u_sc_data(i_s);
+                        double w = 1.0;
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
-                            kernel(X[d],
-                                   x_lower[d] + (d == component ? -0.5 * dx[d] : 0.0),
-                                   x_upper[d] + (d == component ? +0.5 * dx[d] : 0.0),
-                                   dx[d],
-                                   patch_box.lower(d),
-                                   patch_box.upper(d) + (d == component ? 1 : 0),
-                                   stencil_box.lower(d),
-                                   stencil_box.upper(d),
-                                   phi[d],
-                                   dphi[d]);
+                            w *= phi[d][i_shift(d)];
                         }
-                        for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
+                        U(component) += u * w;
+                        for (unsigned int k = 0; k < NDIM; ++k)
                         {
-                            const Index<NDIM>& i = b();
-                            const Index<NDIM> i_shift = i - stencil_box.lower();
-                            const SideIndex<NDIM> i_s(i, component, SideIndex<NDIM>::Lower);
-                            const double u = (*u_data)(i_s);
-                            double w = 1.0;
+                            double dw_dx_k = 1.0;
                             for (unsigned int d = 0; d < NDIM; ++d)
                             {
-                                w *= phi[d][i_shift(d)];
-                            }
-                            U(component) += u * w;
-                            for (unsigned int k = 0; k < NDIM; ++k)
-                            {
-                                double dw_dx_k = 1.0;
-                                for (unsigned int d = 0; d < NDIM; ++d)
+                                if (d == k)
                                 {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
+                                    dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
+                                }
+                                else
+                                {
+                                    dw_dx_k *= phi[d][i_shift(d)];
                                 }
-                                Grad_U(component, k) -= u * dw_dx_k;
                             }
+                            Grad_U(component, k) -= u * dw_dx_k;
                         }
                     }
-                    for (int i = 0; i < NDIM; ++i)
+                }
+                for (int i = 0; i < NDIM; ++i)
+                {
+                    U_array[local_idx][i] = U(i);
+                    for (int j = 0; j < NDIM; ++j)
                     {
-                        U_array[local_idx][i] = U(i);
-                        for (int j = 0; j < NDIM; ++j)
-                        {
-                            Grad_U_array[local_idx][NDIM * i + j] = Grad_U(i, j);
-                        }
+                        Grad_U_array[local_idx][NDIM * i + j] = Grad_U(i, j);
                     }
                 }
             }
@@ -578,39 +657,14 @@ IMPMethod::forwardEulerStep(const double current_time, const double new_time)
 
         // Update the deformation gradient.
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        std::vector<int> idxs;
+        get_global_petsc_indices(idxs, mesh->getLocalNodes());
         boost::multi_array_ref<double, 2>& F_current_array = *d_F_current_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_half_array = *d_F_half_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& Grad_U_array = *(*Grad_U_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, F_half, Grad_U;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U(i, j) = Grad_U_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new = tensor_inverse(I - 0.50 * dt * Grad_U) * (I + 0.50 * dt * Grad_U) * F_current;
-            F_half = tensor_inverse(I - 0.25 * dt * Grad_U) * (I + 0.25 * dt * Grad_U) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                    F_half_array[idx][NDIM * i + j] = F_half(i, j);
-                }
-            }
-        }
+        update_deformation_gradient(F_new_array, F_current_array, Grad_U_array, Grad_U_array, 0.50 * dt, idxs);
+        update_deformation_gradient(F_half_array, F_current_array, Grad_U_array, Grad_U_array, 0.25 * dt, idxs);
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -636,36 +690,12 @@ IMPMethod::midpointStep(const double current_time, const double new_time)
 
         // Update the deformation gradient.
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        std::vector<int> idxs;
+        get_global_petsc_indices(idxs, mesh->getLocalNodes());
         boost::multi_array_ref<double, 2>& F_current_array = *d_F_current_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& Grad_U_array = *(*Grad_U_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, Grad_U;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U(i, j) = Grad_U_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new = tensor_inverse(I - 0.5 * dt * Grad_U) * (I + 0.5 * dt * Grad_U) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                }
-            }
-        }
+        update_deformation_gradient(F_new_array, F_current_array, Grad_U_array, Grad_U_array, 0.5 * dt, idxs);
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -695,38 +725,14 @@ IMPMethod::trapezoidalStep(const double current_time, const double new_time)
 
         // Update the deformation gradient.
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        std::vector<int> idxs;
+        get_global_petsc_indices(idxs, mesh->getLocalNodes());
         boost::multi_array_ref<double, 2>& F_current_array = *d_F_current_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_new_array = *d_F_new_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& Grad_U_current_array = *(*Grad_U_current_data)[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& Grad_U_new_array = *(*Grad_U_new_data)[ln]->getVecArray();
-        TensorValue<double> F_current, F_new, Grad_U_current, Grad_U_new;
-        TensorValue<double> I(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0);
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
-        {
-            const LNode* const node_idx = *cit;
-            const int idx = node_idx->getGlobalPETScIndex();
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_current(i, j) = F_current_array[idx][NDIM * i + j];
-                    Grad_U_current(i, j) = Grad_U_current_array[idx][NDIM * i + j];
-                    Grad_U_new(i, j) = Grad_U_new_array[idx][NDIM * i + j];
-                }
-            }
-#if (NDIM == 2)
-            F_current(2, 2) = 1.0;
-#endif
-            F_new = tensor_inverse(I - 0.5 * dt * Grad_U_new) * (I + 0.5 * dt * Grad_U_current) * F_current;
-            for (int i = 0; i < NDIM; ++i)
-            {
-                for (int j = 0; j < NDIM; ++j)
-                {
-                    F_new_array[idx][NDIM * i + j] = F_new(i, j);
-                }
-            }
-        }
+        update_deformation_gradient(
+            F_new_array, F_current_array, Grad_U_current_array, Grad_U_new_array, 0.5 * dt, idxs);
     }
     d_X_new_needs_ghost_fill = true;
     d_X_half_needs_reinit = true;
@@ -751,6 +757,80 @@ IMPMethod::computeLagrangianForce(const double data_time)
         boost::multi_array_ref<double, 2>& X_array = *d_X0_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_array = *(*F_data)[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& tau_array = *d_tau_data[ln]->getVecArray();
+        if (d_PK1_stress_batch_fcn)
+        {
+            // Evaluate the stresses of blocks of material points with single
+            // calls to the batched PK1 stress function.
+            std::vector<int> idxs;
+            std::vector<MaterialPointSpec*> mp_specs;
+            idxs.reserve(local_nodes.size());
+            mp_specs.reserve(local_nodes.size());
+            for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+            {
+                const LNode* const node_idx = *cit;
+                const int idx = node_idx->getGlobalPETScIndex();
+                MaterialPointSpec* mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
+                if (mp_spec)
+                {
+                    idxs.push_back(idx);
+                    mp_specs.push_back(mp_spec);
+                }
+                else
+                {
+                    for (int i = 0; i < NDIM * NDIM; ++i) tau_array[idx][i] = 0.0;
+                }
+            }
+            const int num_points = static_cast<int>(idxs.size());
+            const int max_batch_size = std::min(num_points, PK1_STRESS_BATCH_SIZE);
+            std::vector<TensorValue<double> > PP(max_batch_size), FF(max_batch_size);
+            std::vector<libMesh::Point> x(max_batch_size), X(max_batch_size);
+            std::vector<subdomain_id_type> subdomain_ids(max_batch_size);
+            std::vector<std::vector<double>*> internal_vars(max_batch_size);
+            for (int k0 = 0; k0 < num_points; k0 += PK1_STRESS_BATCH_SIZE)
+            {
+                const int batch_size = std::min(num_points - k0, PK1_STRESS_BATCH_SIZE);
+                PP.resize(batch_size);
+                FF.resize(batch_size);
+                x.resize(batch_size);
+                X.resize(batch_size);
+                subdomain_ids.resize(batch_size);
+                internal_vars.resize(batch_size);
+                for (int k = 0; k < batch_size; ++k)
+                {
+                    const int idx = idxs[k0 + k];
+                    FF[k].zero();
+                    for (int i = 0; i < NDIM; ++i)
+                    {
+                        for (int j = 0; j < NDIM; ++j)
+                        {
+                            FF[k](i, j) = F_array[idx][NDIM * i + j];
+                        }
+                        x[k](i) = x_array[idx][i];
+                        X[k](i) = X_array[idx][i];
+                    }
+#if (NDIM == 2)
+                    FF[k](2, 2) = 1.0;
+#endif
+                    subdomain_ids[k] = mp_specs[k0 + k]->getSubdomainId();
+                    internal_vars[k] = &mp_specs[k0 + k]->getInternalVariables();
+                }
+                (*d_PK1_stress_batch_fcn)(
+                    PP, FF, x, X, subdomain_ids, internal_vars, data_time, d_PK1_stress_batch_fcn_ctx);
+                IBTK_PARALLEL_FOR(k, batch_size)
+                {
+                    const int idx = idxs[k0 + k];
+                    const TensorValue<double> tau = PP[k] * FF[k].transpose();
+                    for (int i = 0; i < NDIM; ++i)
+                    {
+                        for (int j = 0; j < NDIM; ++j)
+                        {
+                            tau_array[idx][NDIM * i + j] = tau(i, j);
+                        }
+                    }
+                }
+            }
+            continue;
+        }
         TensorValue<double> FF, PP, tau;
         VectorValue<double> X, x;
         for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
@@ -890,13 +970,7 @@ IMPMethod::spreadForce(const int f_data_idx,
                     // Weight tau using a smooth kernel function evaluated about
                     // X.
                     Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    boost::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
+                    boost::array<boost::array<double, 2 * kernel_width>, NDIM> phi, dphi;
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
                         for (unsigned int d = 0; d < NDIM; ++d)
@@ -988,6 +1062,18 @@ IMPMethod::registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void*
 {
     d_PK1_stress_fcn = PK1_stress_fcn;
     d_PK1_stress_fcn_ctx = PK1_stress_fcn_ctx;
+    d_PK1_stress_batch_fcn = NULL;
+    d_PK1_stress_batch_fcn_ctx = NULL;
+    return;
+} // registerPK1StressTensorFunction
+
+void
+IMPMethod::registerPK1StressTensorFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn, void* PK1_stress_batch_fcn_ctx)
+{
+    d_PK1_stress_fcn = NULL;
+    d_PK1_stress_fcn_ctx = NULL;
+    d_PK1_stress_batch_fcn = PK1_stress_batch_fcn;
+    d_PK1_stress_batch_fcn_ctx = PK1_stress_batch_fcn_ctx;
     return;
 } // registerPK1StressTensorFunction
 
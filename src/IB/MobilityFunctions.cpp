@@ -36,6 +36,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <algorithm>
+#include <vector>
 
 #include "ibamr/MobilityFunctions.h"
 
@@ -568,6 +570,157 @@ getEmpiricalMobilityComponents(const char* IBKernelName,
     }
     return;
 } // getEmpiricalMobilityComponents
+
+// Maximum number of markers stored in a leaf of the cluster tree used to
+// approximate RPY mobility products.
+const int RPY_TREE_LEAF_SIZE = 16;
+
+// Node of the cluster tree used to approximate RPY mobility products.
+struct RPYTreeNode
+{
+    double center[NDIM]; // centroid of the markers in the cluster
+    double radius;       // maximum distance of a marker from the centroid
+    double F[NDIM];      // total force applied to the markers in the cluster
+    double D[NDIM][NDIM]; // force dipole moment about the centroid
+    int begin, end;      // range of the cluster in the marker permutation
+    int child[2];        // child clusters, or -1 for a leaf
+};
+
+// Orders marker indices by their coordinate along a given axis.
+struct RPYAxisComp
+{
+    RPYAxisComp(const double* X_in, const int axis_in) : X(X_in), axis(axis_in)
+    {
+    }
+
+    bool operator()(const int a, const int b) const
+    {
+        return X[a * NDIM + axis] < X[b * NDIM + axis];
+    }
+
+    const double* X;
+    int axis;
+};
+
+// Recursively builds the cluster tree by bisecting the longest extent of each
+// cluster, and returns the index of the new node.
+int
+buildRPYTree(std::vector<RPYTreeNode>& tree, std::vector<int>& perm, const double* X, const int begin, const int end)
+{
+    RPYTreeNode node;
+    node.begin = begin;
+    node.end = end;
+    node.child[0] = node.child[1] = -1;
+    double X_lower[NDIM], X_upper[NDIM];
+    int k, d;
+    for (d = 0; d < NDIM; d++)
+    {
+        node.center[d] = 0.0;
+        node.F[d] = 0.0;
+        for (k = 0; k < NDIM; k++) node.D[d][k] = 0.0;
+        X_lower[d] = X[perm[begin] * NDIM + d];
+        X_upper[d] = X[perm[begin] * NDIM + d];
+    }
+    for (k = begin; k < end; k++)
+    {
+        for (d = 0; d < NDIM; d++)
+        {
+            const double x = X[perm[k] * NDIM + d];
+            node.center[d] += x;
+            X_lower[d] = std::min(X_lower[d], x);
+            X_upper[d] = std::max(X_upper[d], x);
+        }
+    }
+    for (d = 0; d < NDIM; d++) node.center[d] /= static_cast<double>(end - begin);
+    double rsq_max = 0.0;
+    for (k = begin; k < end; k++)
+    {
+        double r_vec[NDIM];
+        for (d = 0; d < NDIM; d++) r_vec[d] = X[perm[k] * NDIM + d] - node.center[d];
+        rsq_max = std::max(rsq_max, get_sqnorm(r_vec));
+    }
+    node.radius = sqrt(rsq_max);
+
+    const int idx = static_cast<int>(tree.size());
+    tree.push_back(node);
+    if (end - begin <= RPY_TREE_LEAF_SIZE) return idx;
+
+    int axis = 0;
+    for (d = 1; d < NDIM; d++)
+    {
+        if (X_upper[d] - X_lower[d] > X_upper[axis] - X_lower[axis]) axis = d;
+    }
+    const int mid = (begin + end) / 2;
+    std::nth_element(perm.begin() + begin, perm.begin() + mid, perm.begin() + end, RPYAxisComp(X, axis));
+    const int child0 = buildRPYTree(tree, perm, X, begin, mid);
+    const int child1 = buildRPYTree(tree, perm, X, mid, end);
+    tree[idx].child[0] = child0;
+    tree[idx].child[1] = child1;
+    return idx;
+} // buildRPYTree
+
+// Adds the RPY velocity induced at a marker by a force applied at separation
+// r_vec; the far-field form is used when r exceeds twice the hydrodynamic
+// radius.
+void
+addRPYPairVelocity(const double* r_vec, const double mu_tt, const double* F, double* U)
+{
+    const double rsq = get_sqnorm(r_vec);
+    const double r = sqrt(rsq);
+    double r_dot_F = 0.0;
+    int d;
+    for (d = 0; d < NDIM; d++) r_dot_F += r_vec[d] * F[d];
+    double c_id, c_rr;
+    if (r <= 2.0 * HRad)
+    {
+        c_id = mu_tt * (1 - 9.0 / 32.0 * r / HRad);
+        c_rr = mu_tt / rsq * 3.0 * r / 32. / HRad;
+    }
+    else
+    {
+        const double cube = HRad * HRad * HRad / r / r / r;
+        c_id = mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube);
+        c_rr = mu_tt / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
+    }
+    for (d = 0; d < NDIM; d++) U[d] += c_id * F[d] + c_rr * r_dot_F * r_vec[d];
+    return;
+} // addRPYPairVelocity
+
+// Adds the far-field RPY velocity induced at a marker by a force dipole D
+// located at separation r_vec, i.e., the first-order correction to the
+// velocity induced by the total force on a cluster of markers.
+void
+addRPYDipoleVelocity(const double* r_vec, const double mu_tt, const double D[NDIM][NDIM], double* U)
+{
+    const double rsq = get_sqnorm(r_vec);
+    const double r = sqrt(rsq);
+    const double a = HRad, a3 = HRad * HRad * HRad;
+
+    // The far-field RPY tensor is G = A(r) I + B(r) r r^T.
+    const double B = mu_tt * (3.0 / 4.0 * a / (rsq * r) - 3.0 / 2.0 * a3 / (rsq * rsq * r));
+    const double dA_over_r = mu_tt * (-3.0 / 4.0 * a / (rsq * r) - 3.0 / 2.0 * a3 / (rsq * rsq * r));
+    const double dB_over_r = mu_tt * (-9.0 / 4.0 * a / (rsq * rsq * r) + 15.0 / 2.0 * a3 / (rsq * rsq * rsq * r));
+
+    double rD[NDIM], Dr[NDIM], rDr = 0.0, trD = 0.0;
+    int i, k;
+    for (i = 0; i < NDIM; i++)
+    {
+        rD[i] = 0.0;
+        Dr[i] = 0.0;
+        for (k = 0; k < NDIM; k++)
+        {
+            rD[i] += r_vec[k] * D[k][i];
+            Dr[i] += D[i][k] * r_vec[k];
+        }
+        rDr += rD[i] * r_vec[i];
+        trD += D[i][i];
+    }
+    for (i = 0; i < NDIM; i++)
+    {
+        U[i] -= dA_over_r * rD[i] + dB_over_r * rDr * r_vec[i] + B * (Dr[i] + trD * r_vec[i]);
+    }
+    return;
+} // addRPYDipoleVelocity
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -695,6 +848,121 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobilityMatrix(const char* IBKernelName,
+                                          const double MU,
+                                          const double DX,
+                                          const double* X,
+                                          const int N,
+                                          const double PERIODIC_CORRECTION,
+                                          const double* F,
+                                          double* U,
+                                          const double opening_angle)
+{
+    HRad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
+
+    // Self-mobility and periodic correction terms.
+    double F_total[NDIM];
+    int row, col, d;
+    for (d = 0; d < NDIM; d++) F_total[d] = 0.0;
+    for (col = 0; col < N; col++)
+        for (d = 0; d < NDIM; d++) F_total[d] += F[col * NDIM + d];
+    for (row = 0; row < N; row++)
+        for (d = 0; d < NDIM; d++) U[row * NDIM + d] = mu_tt * F[row * NDIM + d] - PERIODIC_CORRECTION * F_total[d];
+
+    double r_vec[NDIM];
+    if (opening_angle <= 0.0)
+    {
+        // Exact product.
+        for (row = 0; row < N; row++)
+            for (col = 0; col < N; col++)
+            {
+                if (row == col) continue;
+                for (d = 0; d < NDIM; d++) r_vec[d] = X[row * NDIM + d] - X[col * NDIM + d];
+                addRPYPairVelocity(r_vec, mu_tt, &F[col * NDIM], &U[row * NDIM]);
+            }
+        return;
+    }
+
+    // Build the cluster tree and accumulate the total force on each cluster.
+    // Children are always stored after their parents.
+    std::vector<int> perm(N);
+    for (col = 0; col < N; col++) perm[col] = col;
+    std::vector<RPYTreeNode> tree;
+    tree.reserve(2 * (N / RPY_TREE_LEAF_SIZE + 1));
+    if (N > 0) buildRPYTree(tree, perm, X, 0, N);
+    for (int n = static_cast<int>(tree.size()) - 1; n >= 0; n--)
+    {
+        RPYTreeNode& node = tree[n];
+        if (node.child[0] < 0)
+        {
+            for (int k = node.begin; k < node.end; k++)
+            {
+                const double* F_k = &F[perm[k] * NDIM];
+                for (d = 0; d < NDIM; d++)
+                {
+                    node.F[d] += F_k[d];
+                    const double s = X[perm[k] * NDIM + d] - node.center[d];
+                    for (int l = 0; l < NDIM; l++) node.D[d][l] += s * F_k[l];
+                }
+            }
+        }
+        else
+        {
+            for (int c = 0; c < 2; c++)
+            {
+                const RPYTreeNode& child = tree[node.child[c]];
+                for (d = 0; d < NDIM; d++)
+                {
+                    node.F[d] += child.F[d];
+                    const double s = child.center[d] - node.center[d];
+                    for (int l = 0; l < NDIM; l++) node.D[d][l] += child.D[d][l] + s * child.F[l];
+                }
+            }
+        }
+    }
+
+    // Interactions with well-separated clusters are approximated by far-field
+    // interactions with the total force and force dipole of the cluster about
+    // its centroid; all other interactions are computed exactly.
+    std::vector<int> stack;
+    for (row = 0; row < N; row++)
+    {
+        const double* X_row = &X[row * NDIM];
+        double* U_row = &U[row * NDIM];
+        if (!tree.empty()) stack.push_back(0);
+        while (!stack.empty())
+        {
+            const RPYTreeNode& node = tree[stack.back()];
+            stack.pop_back();
+            for (d = 0; d < NDIM; d++) r_vec[d] = X_row[d] - node.center[d];
+            const double r = sqrt(get_sqnorm(r_vec));
+            if (node.child[0] >= 0 && r - node.radius > 2.0 * HRad && node.radius < opening_angle * r)
+            {
+                addRPYPairVelocity(r_vec, mu_tt, node.F, U_row);
+                addRPYDipoleVelocity(r_vec, mu_tt, node.D, U_row);
+            }
+            else if (node.child[0] >= 0)
+            {
+                stack.push_back(node.child[0]);
+                stack.push_back(node.child[1]);
+            }
+            else
+            {
+                for (int k = node.begin; k < node.end; k++)
+                {
+                    col = perm[k];
+                    if (row == col) continue;
+                    for (d = 0; d < NDIM; d++) r_vec[d] = X_row[d] - X[col * NDIM + d];
+                    addRPYPairVelocity(r_vec, mu_tt, &F[col * NDIM], U_row);
+                }
+            }
+        }
+    }
+    return;
+} // applyRPYMobilityMatrix
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // IBAMR
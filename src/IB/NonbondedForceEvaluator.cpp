@@ -32,9 +32,15 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <vector>
+
 #include "ibamr/NonbondedForceEvaluator.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LNodeSetData.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "tbox/TimerManager.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -42,6 +48,63 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Timers.
+static Timer* t_compute_lagrangian_force;
+static Timer* t_build_neighbor_list;
+
+// Minimum number of pairs per thread for which the pair forces are computed
+// in parallel.
+static const int MIN_PAIRS_PER_THREAD = 1024;
+
+// Offset of a cell in the flat cell list of a box.
+inline int
+cell_offset(const Index<NDIM>& i, const Box<NDIM>& box)
+{
+    int offset = 0, stride = 1;
+    for (int k = 0; k < NDIM; ++k)
+    {
+        offset += (i(k) - box.lower(k)) * stride;
+        stride *= box.numberCells(k);
+    }
+    return offset;
+} // cell_offset
+
+// Accumulate the forces for the pairs [begin,end) of the neighbor list.
+inline void
+accumulate_pair_forces(const int begin,
+                       const int end,
+                       const int* const mstr_idxs,
+                       const int* const search_idxs,
+                       const double* const shifts,
+                       const double* const X,
+                       NonbondedForceEvaluator::NonBddForceFcnPtr force_fcn_ptr,
+                       const Array<double>& parameters,
+                       double* const F)
+{
+    double D[NDIM], nonbdd_force[NDIM];
+    for (int p = begin; p < end; ++p)
+    {
+        const double* const X_mstr = &X[mstr_idxs[p] * NDIM];
+        const double* const X_search = &X[search_idxs[p] * NDIM];
+        for (int k = 0; k < NDIM; ++k)
+        {
+            D[k] = X_mstr[k] - X_search[k] - shifts[p * NDIM + k];
+        }
+        (force_fcn_ptr)(D, parameters, nonbdd_force);
+        double* const F_mstr = &F[mstr_idxs[p] * NDIM];
+        double* const F_search = &F[search_idxs[p] * NDIM];
+        for (int k = 0; k < NDIM; ++k)
+        {
+            F_mstr[k] += nonbdd_force[k];
+            F_search[k] -= nonbdd_force[k];
+        }
+    }
+    return;
+} // accumulate_pair_forces
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
@@ -75,176 +138,292 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // get neighbor list parameters
+    d_neighbor_list_cutoff = input_db->getDoubleWithDefault("neighbor_list_cutoff", -1.0);
+    d_neighbor_list_skin = input_db->getDoubleWithDefault("neighbor_list_skin", 0.0);
+    if (d_neighbor_list_skin < 0.0)
+    {
+        TBOX_ERROR("neighbor_list_skin for NonbondedForceEvaluator must be nonnegative.");
+    }
+    d_neighbor_list_is_valid = false;
+    d_neighbor_list_level_number = -1;
+    d_neighbor_list_redistribution_count = 0;
+
+    // get logging options
+    d_log_pair_throughput = input_db->getBoolWithDefault("log_pair_throughput", false);
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_compute_lagrangian_force =
+                      TimerManager::getManager()->getTimer("IBAMR::NonbondedForceEvaluator::computeLagrangianForce()");
+                  t_build_neighbor_list =
+                      TimerManager::getManager()->getTimer("IBAMR::NonbondedForceEvaluator::buildNeighborList()"););
 }
 
 void
-NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
-                                        int search_petsc_idx,
-                                        Pointer<LData> X_data,
-                                        std::vector<int> cell_offset,
-                                        Pointer<LData> F_data)
+NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
+                                                Pointer<LData> X_data,
+                                                Pointer<LData> /*U_data*/,
+                                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                const int level_number,
+                                                const double /*data_time*/,
+                                                LDataManager* const l_data_manager)
 {
-    //   Function to add nonbonded forces from the interaction between the nodes at
-    //   mstr_petsc_idx and search_petsc_idx.
-    //
-    //   inputs: mstr_petsc_idx:    integer petsc index of the master node
-    //           search_petsc_idx:  integer petsc index of the search node
-    //           X_data:            pointer to LData of location values for the particles
-    //           cell_offset:       vector of periodic offsets of the search particle,
-    //                    integer value in units of the entire domain.  E.G. a particle
-    //                    image at position (120, -20, 10)  in a length 100^3 domain
-    //                    would have cell_offset = (1, -1, 0).
-    //
-    //   outputs:
-    //          F_data - pointer to LData object containing forces on particles.  Will
-    //                   be added to by this function.
-    //
-    //////////////////////////////////////////////////////////////////////////////////
-
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
+    IBAMR_TIMER_START(t_compute_lagrangian_force);
+
+    // Get grid geometry.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
+
+    // Get the position and force data.
     PetscScalar* position;
     VecGetArray(X_data->getVec(), &position);
     PetscScalar* force;
     VecGetArray(F_data->getVec(), &force);
+    int num_local_values;
+    VecGetLocalSize(X_data->getVec(), &num_local_values);
 
-    // get domain bounds
-    const double* x_lower = d_grid_geometry->getXLower();
-    const double* x_upper = d_grid_geometry->getXUpper();
-
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
-    for (int k = 0; k < NDIM; ++k)
+    // Rebuild the neighbor list, if necessary.
+    if (neighborListNeedsRebuild(position, num_local_values, level_number, l_data_manager))
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += pow(D[k], 2);
+        buildNeighborList(position, num_local_values, hierarchy, level_number, l_data_manager);
     }
-    R = sqrt(R);
 
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
+    // Loop over the neighbor list and accumulate the forces.
+    const double start_time = d_log_pair_throughput ? MPI_Wtime() : 0.0;
+    const int num_pairs = static_cast<int>(d_neighbor_mstr_idxs.size());
+    const int* const mstr_idxs = d_neighbor_mstr_idxs.empty() ? NULL : &d_neighbor_mstr_idxs[0];
+    const int* const search_idxs = d_neighbor_search_idxs.empty() ? NULL : &d_neighbor_search_idxs[0];
+    const double* const shifts = d_neighbor_periodic_shifts.empty() ? NULL : &d_neighbor_periodic_shifts[0];
+    const int num_blocks =
+        std::min(ParallelPatchFor::getMaxNumberOfThreads(), std::max(num_pairs / MIN_PAIRS_PER_THREAD, 1));
+    if (num_blocks == 1)
     {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+        accumulate_pair_forces(
+            0, num_pairs, mstr_idxs, search_idxs, shifts, position, d_force_fcn_ptr, d_parameters, force);
+    }
+    else
+    {
+        // The list is split into one contiguous block of pairs per thread,
+        // which correspond to blocks of master cells.  The first block
+        // accumulates forces directly in the force array, and the other blocks
+        // use their own buffers, which are summed afterwards.  Each block also
+        // uses its own copy of the force parameters, because copying a
+        // SAMRAI::tbox::Array is not thread safe.
+        d_thread_force_data.resize(num_blocks - 1);
+        for (int b = 0; b < num_blocks - 1; ++b)
+        {
+            d_thread_force_data[b].assign(num_local_values, 0.0);
+        }
+        std::vector<Array<double> > block_parameters(num_blocks);
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            block_parameters[b].resizeArray(d_parameters.getSize());
+            for (int i = 0; i < d_parameters.getSize(); ++i) block_parameters[b][i] = d_parameters[i];
+        }
+        IBTK_PARALLEL_FOR(b, num_blocks)
+        {
+            const int begin = static_cast<int>((static_cast<long>(b) * num_pairs) / num_blocks);
+            const int end = static_cast<int>((static_cast<long>(b + 1) * num_pairs) / num_blocks);
+            double* const F_block = b == 0 ? force : &d_thread_force_data[b - 1][0];
+            accumulate_pair_forces(
+                begin, end, mstr_idxs, search_idxs, shifts, position, d_force_fcn_ptr, block_parameters[b], F_block);
+        }
+        IBTK_PARALLEL_FOR(i, num_local_values)
+        {
+            for (int b = 0; b < num_blocks - 1; ++b)
+            {
+                force[i] += d_thread_force_data[b][i];
+            }
+        }
+    }
+    if (d_log_pair_throughput)
+    {
+        const double elapsed_time = MPI_Wtime() - start_time;
+        plog << "NonbondedForceEvaluator: computed " << num_pairs << " pair forces using " << num_blocks
+             << " thread(s) in " << elapsed_time << " s";
+        if (elapsed_time > 0.0) plog << " (" << static_cast<double>(num_pairs) / elapsed_time << " pairs/s)";
+        plog << "\n";
     }
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force);
     return;
-} // evaluateForces
+} // computeLagrangianForce
 
 void
-NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
-                                                Pointer<LData> X_data,
-                                                Pointer<LData> /*U_data*/,
-                                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
-                                                const int level_number,
-                                                const double /*data_time*/,
-                                                LDataManager* const l_data_manager)
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
 {
-    // Get grid geometry and relevant lower and upper limits.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
-    if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
-    const double* const x_lower = grid_geom->getXLower();
-    const double* const x_upper = grid_geom->getXUpper();
-    const double* const domain_dx = grid_geom->getDx();
+/////////////////////////////// PRIVATE //////////////////////////////////////
 
-    // Maximum index in our domain.
-    std::vector<int> max_cell_idx(NDIM);
-    for (int k = 0; k < NDIM; ++k)
+bool
+NonbondedForceEvaluator::neighborListNeedsRebuild(const double* X,
+                                                  const int num_local_values,
+                                                  const int level_number,
+                                                  LDataManager* const l_data_manager)
+{
+    // The candidate pairs change only when the Lagrangian data are
+    // redistributed.
+    if (!d_neighbor_list_is_valid || level_number != d_neighbor_list_level_number ||
+        l_data_manager->getNumberOfDataRedistributions() != d_neighbor_list_redistribution_count ||
+        num_local_values != static_cast<int>(d_neighbor_list_X.size()))
     {
-        max_cell_idx[k] = int((x_upper[k] - x_lower[k]) / domain_dx[k]);
+        return true;
     }
+    if (d_neighbor_list_cutoff < 0.0) return false;
+
+    // When the list is pruned by distance, it remains valid as long as no node
+    // has moved more than half of the skin distance.
+    const double max_displacement_sq = 0.25 * d_neighbor_list_skin * d_neighbor_list_skin;
+    for (int i = 0; i < num_local_values / NDIM; ++i)
+    {
+        double displacement_sq = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            const double dX = X[i * NDIM + k] - d_neighbor_list_X[i * NDIM + k];
+            displacement_sq += dX * dX;
+        }
+        if (displacement_sq > max_displacement_sq) return true;
+    }
+    return false;
+} // neighborListNeedsRebuild
+
+void
+NonbondedForceEvaluator::buildNeighborList(const double* X,
+                                           const int num_local_values,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
+{
+    IBAMR_TIMER_START(t_build_neighbor_list);
+
+    d_neighbor_mstr_idxs.clear();
+    d_neighbor_search_idxs.clear();
+    d_neighbor_periodic_shifts.clear();
+
+    // Get grid geometry and relevant lower and upper limits.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const x_upper = grid_geom->getXUpper();
+    const bool prune_by_distance = d_neighbor_list_cutoff >= 0.0;
+    const double list_radius_sq =
+        (d_neighbor_list_cutoff + d_neighbor_list_skin) * (d_neighbor_list_cutoff + d_neighbor_list_skin);
 
     // we will grow the search box by interaction_radius + 2.0*regrid_alpha
     IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::vector<int> cell_start, node_lag_idxs, node_petsc_idxs;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
         const Box<NDIM>& patch_box = patch->getBox();
+        const Box<NDIM> search_box = Box<NDIM>::grow(patch_box, grow_amount);
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
-        // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
+        // Build a flat cell list that stores the Lagrangian and local PETSc
+        // indices of the nodes in each cell of the search box contiguously.
+        const int num_cells = search_box.size();
+        cell_start.assign(num_cells + 1, 0);
+        for (LNodeSetData::CellIterator cit(search_box); cit; cit++)
+        {
+            const LNodeSet* const node_set = current_idx_data->getItem(*cit);
+            if (node_set) cell_start[cell_offset(*cit, search_box) + 1] = static_cast<int>(node_set->size());
+        }
+        for (int c = 0; c < num_cells; ++c) cell_start[c + 1] += cell_start[c];
+        node_lag_idxs.resize(cell_start[num_cells]);
+        node_petsc_idxs.resize(cell_start[num_cells]);
+        for (LNodeSetData::CellIterator cit(search_box); cit; cit++)
+        {
+            const LNodeSet* const node_set = current_idx_data->getItem(*cit);
+            if (!node_set) continue;
+            int n = cell_start[cell_offset(*cit, search_box)];
+            for (LNodeSet::const_iterator it = node_set->begin(); it != node_set->end(); ++it, ++n)
+            {
+                node_lag_idxs[n] = (*it)->getLagrangianIndex();
+                node_petsc_idxs[n] = (*it)->getLocalPETScIndex();
+            }
+        }
+
+        // Loop through cells in this processors patch. For each iteration,
+        // this is the "master" cell.  Pair the nodes in this cell with the
+        // nodes in neighboring cells, up to interaction_radius + 2*regrid_alpha
+        // away.
+        //
+        // Pairs of cells in the interior of the patch are visited only once
+        // (a half-shell traversal), from the cell with the smaller offset.
+        // Pairs involving ghost cells may also be found by the patch that owns
+        // the ghost cell, or through a periodic image, and so they are kept
+        // only when the master node has the smaller Lagrangian index.
+        double periodic_shift[NDIM];
         for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
         {
-            // get list of particles in this cell
-            const Index<NDIM>& first_cell_idx = *cit;
-            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            const Index<NDIM>& mstr_cell_idx = *cit;
+            const int mstr_cell = cell_offset(mstr_cell_idx, search_box);
+            if (cell_start[mstr_cell] == cell_start[mstr_cell + 1]) continue;
+            Box<NDIM> mstr_box(mstr_cell_idx, mstr_cell_idx);
+            for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(mstr_box, grow_amount)); scit; scit++)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const Index<NDIM>& search_cell_idx = *scit;
+                const int search_cell = cell_offset(search_cell_idx, search_box);
+                const bool search_cell_is_interior = patch_box.contains(search_cell_idx);
+                if (search_cell_is_interior && search_cell < mstr_cell) continue;
+                if (cell_start[search_cell] == cell_start[search_cell + 1]) continue;
+
+                // search across periodic boundaries.
+                for (int k = 0; k < NDIM; ++k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
-                    {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
-                    }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    const double absolute_diff = search_cell_idx[k] * patch_dx[k];
+                    periodic_shift[k] = floor(absolute_diff / (x_upper[k] - x_lower[k])) * (x_upper[k] - x_lower[k]);
+                }
+
+                for (int m = cell_start[mstr_cell]; m < cell_start[mstr_cell + 1]; ++m)
+                {
+                    const int search_begin = search_cell == mstr_cell ? m + 1 : cell_start[search_cell];
+                    for (int s = search_begin; s < cell_start[search_cell + 1]; ++s)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (LNodeSet::iterator it = mstr_node_set->begin(); it != mstr_node_set->end(); ++it)
+                        if (!search_cell_is_interior && node_lag_idxs[m] >= node_lag_idxs[s]) continue;
+                        const int mstr_petsc_idx = node_petsc_idxs[m];
+                        const int search_petsc_idx = node_petsc_idxs[s];
+                        if (prune_by_distance)
                         {
-                            // master nodes
-                            LNodeSet::value_type& mstr_node_idx = *it;
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (LNodeSet::iterator sit = search_node_set->begin(); sit != search_node_set->end();
-                                 ++sit)
+                            double R_sq = 0.0;
+                            for (int k = 0; k < NDIM; ++k)
                             {
-                                LNodeSet::value_type& search_node_idx = *sit;
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
-    return;
-} // computeLagrangianForce
+                                const double D = X[mstr_petsc_idx * NDIM + k] - X[search_petsc_idx * NDIM + k] -
+                                                 periodic_shift[k];
+                                R_sq += D * D;
+                            }
+                            if (R_sq > list_radius_sq) continue;
+                        }
+                        d_neighbor_mstr_idxs.push_back(mstr_petsc_idx);
+                        d_neighbor_search_idxs.push_back(search_petsc_idx);
+                        d_neighbor_periodic_shifts.insert(
+                            d_neighbor_periodic_shifts.end(), periodic_shift, periodic_shift + NDIM);
+                    }
+                }
+            }
+        }
+    }
 
-void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
-{
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    // Record the state for which the list was built.
+    d_neighbor_list_X.assign(X, X + num_local_values);
+    d_neighbor_list_level_number = level_number;
+    d_neighbor_list_redistribution_count = l_data_manager->getNumberOfDataRedistributions();
+    d_neighbor_list_is_valid = true;
+
+    IBAMR_TIMER_STOP(t_build_neighbor_list);
     return;
-} // registerForceFcnPtr
+} // buildNeighborList
 
 //////////////////////////////////////////////////////////////////////////////
 
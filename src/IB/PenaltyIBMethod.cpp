@@ -283,6 +283,18 @@ PenaltyIBMethod::trapezoidalStep(const double current_time, const double new_tim
     return;
 } // trapezoidalStep
 
+void
+PenaltyIBMethod::multirateStep(const double /*current_time*/,
+                              const double /*new_time*/,
+                              const int /*num_substeps*/,
+                              const bool /*interpolate_velocity*/)
+{
+    TBOX_ERROR(d_object_name << "::multirateStep():\n"
+                             << "  multirate time stepping not supported by class PenaltyIBMethod;\n"
+                             << "  use num_structure_substeps = 1 instead.\n");
+    return;
+} // multirateStep
+
 void
 PenaltyIBMethod::computeLagrangianForce(const double data_time)
 {
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -70,6 +71,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/ParallelPatchFor.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -432,15 +434,9 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
     }
 #endif
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_Q_scratch_idx);
-        level->allocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->allocatePatchData(d_q_flux_idx);
-    }
+    // Scratch data are allocated by initializeOperatorState().  Reallocate
+    // any data freed by other operators that share the scratch variables.
+    allocateScratchData();
 
     // Setup communications algorithm.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
@@ -627,9 +623,10 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
@@ -772,16 +769,6 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Q_scratch_idx);
-        level->deallocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->deallocatePatchData(d_q_flux_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -835,6 +822,10 @@ AdvDiffPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorReal<NDI
         d_ghostfill_scheds[ln] = d_ghostfill_alg->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategy);
     }
 
+    // Allocate scratch data.  The data are retained until the operator state
+    // is deallocated, i.e., until the hierarchy configuration changes.
+    allocateScratchData();
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -857,6 +848,15 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_Q_scratch_idx)) level->deallocatePatchData(d_Q_scratch_idx);
+        if (level->checkAllocated(d_q_extrap_idx)) level->deallocatePatchData(d_q_extrap_idx);
+        if (level->checkAllocated(d_q_flux_idx)) level->deallocatePatchData(d_q_flux_idx);
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -867,6 +867,23 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffPPMConvectiveOperator::allocateScratchData()
+{
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_Q_scratch_idx)) level->allocatePatchData(d_Q_scratch_idx);
+        if (!level->checkAllocated(d_q_extrap_idx)) level->allocatePatchData(d_q_extrap_idx);
+        if ((d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC) &&
+            !level->checkAllocated(d_q_flux_idx))
+        {
+            level->allocatePatchData(d_q_flux_idx);
+        }
+    }
+    return;
+} // allocateScratchData
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -34,10 +34,13 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <deque>
+#include <limits>
 #include <map>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,6 +48,7 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "FaceData.h"
@@ -61,6 +65,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -72,6 +77,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
@@ -127,6 +133,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(c
     d_default_init_convective_time_stepping_type = MIDPOINT_RULE;
     d_default_convective_op_type = AdvDiffConvectiveOperatorManager::DEFAULT;
     d_default_convective_op_input_db = new MemoryDatabase(d_object_name + "::default_convective_op_input_db");
+    d_batch_helmholtz_solves = false;
+    d_batch_helmholtz_max_rhs_norm_ratio = 10.0;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -450,10 +458,34 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
                          "CONSERVATIVE_LINEAR_REFINE");
     }
 
+    // Group together quantities whose Helmholtz systems may be solved
+    // simultaneously.
+    setupHelmholtzSolveBatches();
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Setup the solvers used for grouped Helmholtz solves.
+    d_batch_helmholtz_solvers.resize(d_helmholtz_batches.size());
+    d_batch_helmholtz_solvers_need_init.resize(d_helmholtz_batches.size(), true);
+    for (unsigned int b = 0; b < d_helmholtz_batches.size(); ++b)
+    {
+        std::ostringstream batch_name;
+        batch_name << "batch_" << b;
+        d_batch_helmholtz_solvers[b] =
+            CCPoissonSolverManager::getManager()->allocateSolver(d_helmholtz_solver_type,
+                                                                 d_object_name + "::helmholtz_solver::" +
+                                                                     batch_name.str(),
+                                                                 d_helmholtz_solver_db,
+                                                                 "adv_diff_",
+                                                                 d_helmholtz_precond_type,
+                                                                 d_object_name + "::helmholtz_precond::" +
+                                                                     batch_name.str(),
+                                                                 d_helmholtz_precond_db,
+                                                                 "adv_diff_pc_");
+    }
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -501,10 +533,19 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     {
         std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+        std::fill(d_batch_helmholtz_solvers_need_init.begin(), d_batch_helmholtz_solvers_need_init.end(), true);
         d_coarsest_reset_ln = 0;
         d_finest_reset_ln = finest_ln;
     }
 
+    // Determine which groups of quantities can be solved together during the
+    // present time step.
+    d_helmholtz_batch_active.resize(d_helmholtz_batches.size());
+    for (unsigned int b = 0; b < d_helmholtz_batches.size(); ++b)
+    {
+        d_helmholtz_batch_active[b] = isHelmholtzSolveBatchActive(b);
+    }
+
     // Allocate the scratch and new data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -629,14 +670,45 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
         helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
 
-        // Initialize the linear solver.
+        // Initialize the linear solver.  When the quantity belongs to a group
+        // of quantities that are solved together, the solver for the group is
+        // initialized instead.
+        const int b = d_Q_helmholtz_batch[l];
+        const bool batched = b >= 0 && d_helmholtz_batch_active[b];
+        if (batched && l == d_helmholtz_batches[b].front())
+        {
+            std::vector<RobinBcCoefStrategy<NDIM>*> batch_bc_coef;
+            for (std::vector<unsigned int>::const_iterator it = d_helmholtz_batches[b].begin();
+                 it != d_helmholtz_batches[b].end();
+                 ++it)
+            {
+                const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coef = d_Q_bc_coef[d_Q_var[*it]];
+                batch_bc_coef.insert(batch_bc_coef.end(), bc_coef.begin(), bc_coef.end());
+            }
+            Pointer<PoissonSolver> batch_helmholtz_solver = d_batch_helmholtz_solvers[b];
+            batch_helmholtz_solver->setPoissonSpecifications(solver_spec);
+            batch_helmholtz_solver->setPhysicalBcCoefs(batch_bc_coef);
+            batch_helmholtz_solver->setHomogeneousBc(false);
+            batch_helmholtz_solver->setSolutionTime(new_time);
+            batch_helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_batch_helmholtz_solvers_need_init[b])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for variable group number " << b << "\n";
+                }
+                batch_helmholtz_solver->initializeSolverState(*d_batch_sol_vecs[b], *d_batch_rhs_vecs[b]);
+                d_batch_helmholtz_solvers_need_init[b] = false;
+            }
+        }
         Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
         helmholtz_solver->setPoissonSpecifications(solver_spec);
         helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        if (!batched && d_helmholtz_solvers_need_init[l])
         {
             if (d_enable_logging)
             {
@@ -726,6 +798,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
     }
 
     // Perform a single step of fixed point iteration.
+    std::vector<TimeSteppingType> convective_time_stepping_types(d_Q_var.size(), UNKNOWN_TIME_STEPPING_TYPE);
     unsigned int l = 0;
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit, ++l)
@@ -734,11 +807,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
         Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
 
-        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
-        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
         const int F_scratch_idx =
             d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getScratchContext()) : -1;
-        const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
         // Update the advection velocity.
@@ -853,40 +923,19 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
         }
 
-        // Solve for Q(n+1).
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
-        d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
-        if (d_enable_logging)
-            plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
-                 << helmholtz_solver->getNumIterations() << "\n";
-        if (d_enable_logging)
-            plog << d_object_name << "::integrateHierarchy(): diffusion solve residual norm        = "
-                 << helmholtz_solver->getResidualNorm() << "\n";
-        if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
-        {
-            pout << d_object_name << "::integrateHierarchy():"
-                 << "  WARNING: linear solver iterations == max iterations\n";
-        }
-
-        // Reset the right-hand side vector.
-        if (u_var)
+        // Solve for Q(n+1).  Quantities that are solved together with other
+        // quantities are handled once the right-hand side of the last member
+        // of the group has been computed.
+        convective_time_stepping_types[l] = convective_time_stepping_type;
+        const int b = d_Q_helmholtz_batch[l];
+        if (b >= 0 && d_helmholtz_batch_active[b])
         {
-            const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
-            if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
-            {
-                d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +1.0, N_scratch_idx, Q_rhs_scratch_idx);
-            }
-            else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
-            {
-                d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +0.5, N_scratch_idx, Q_rhs_scratch_idx);
-            }
-        }
-        if (d_F_fcn[F_var])
-        {
-            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_scratch_idx, Q_rhs_scratch_idx);
-            d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+            if (l == d_helmholtz_batches[b].back()) solveHelmholtzSolveBatch(b, convective_time_stepping_types);
+            continue;
         }
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+        helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+        completeHelmholtzSolve(l, convective_time_stepping_type, helmholtz_solver);
     }
 
     // Execute any registered callbacks.
@@ -960,6 +1009,25 @@ AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         d_Q_convective_op_needs_init[Q_var] = true;
     }
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the solution and rhs vectors for grouped Helmholtz solves.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    d_batch_sol_vecs.resize(d_helmholtz_batches.size());
+    d_batch_rhs_vecs.resize(d_helmholtz_batches.size());
+    for (unsigned int b = 0; b < d_helmholtz_batches.size(); ++b)
+    {
+        const int batch_sol_idx = var_db->mapVariableAndContextToIndex(d_batch_sol_var[b], getScratchContext());
+        d_batch_sol_vecs[b] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::sol_vec::" + d_batch_sol_var[b]->getName(), d_hierarchy, 0, finest_hier_level);
+        d_batch_sol_vecs[b]->addComponent(d_batch_sol_var[b], batch_sol_idx, wgt_idx, d_hier_cc_data_ops);
+
+        const int batch_rhs_idx = var_db->mapVariableAndContextToIndex(d_batch_rhs_var[b], getScratchContext());
+        d_batch_rhs_vecs[b] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::rhs_vec::" + d_batch_rhs_var[b]->getName(), d_hierarchy, 0, finest_hier_level);
+        d_batch_rhs_vecs[b]->addComponent(d_batch_rhs_var[b], batch_rhs_idx, wgt_idx, d_hier_cc_data_ops);
+    }
+    std::fill(d_batch_helmholtz_solvers_need_init.begin(), d_batch_helmholtz_solvers_need_init.end(), true);
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -1025,6 +1093,9 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("batch_helmholtz_solves")) d_batch_helmholtz_solves = db->getBool("batch_helmholtz_solves");
+    if (db->keyExists("batch_helmholtz_max_rhs_norm_ratio"))
+        d_batch_helmholtz_max_rhs_norm_ratio = db->getDouble("batch_helmholtz_max_rhs_norm_ratio");
     return;
 } // getFromInput
 
@@ -1051,6 +1122,267 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupHelmholtzSolveBatches()
+{
+    d_Q_helmholtz_batch.assign(d_Q_var.size(), -1);
+    d_helmholtz_batches.clear();
+    if (!d_batch_helmholtz_solves) return;
+
+    // Group together consecutive quantities with constant diffusion
+    // coefficients that share the same diffusion time stepping type, diffusion
+    // coefficient, and damping coefficient.  Only the first quantity in a group
+    // may have a source term, because the source terms of later quantities
+    // could depend on the updated values of earlier quantities.
+    std::vector<std::vector<unsigned int> > candidate_batches;
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+        if (d_Q_is_diffusion_coef_variable[Q_var]) continue;
+        bool found_batch = false;
+        if (!candidate_batches.empty() && candidate_batches.back().back() + 1 == l && !d_Q_F_map[Q_var])
+        {
+            Pointer<CellVariable<NDIM, double> > Q0_var = d_Q_var[candidate_batches.back().front()];
+            if (d_Q_diffusion_time_stepping_type[Q_var] == d_Q_diffusion_time_stepping_type[Q0_var] &&
+                d_Q_diffusion_coef[Q_var] == d_Q_diffusion_coef[Q0_var] &&
+                d_Q_damping_coef[Q_var] == d_Q_damping_coef[Q0_var])
+            {
+                candidate_batches.back().push_back(l);
+                found_batch = true;
+            }
+        }
+        if (!found_batch) candidate_batches.push_back(std::vector<unsigned int>(1, l));
+    }
+
+    // Register the variables used to solve each group of two or more
+    // quantities.
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (unsigned int k = 0; k < candidate_batches.size(); ++k)
+    {
+        if (candidate_batches[k].size() < 2) continue;
+        const unsigned int b = static_cast<unsigned int>(d_helmholtz_batches.size());
+        d_helmholtz_batches.push_back(candidate_batches[k]);
+        int batch_depth = 0;
+        for (std::vector<unsigned int>::const_iterator it = candidate_batches[k].begin();
+             it != candidate_batches[k].end();
+             ++it)
+        {
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = d_Q_var[*it]->getPatchDataFactory();
+            batch_depth += Q_factory->getDefaultDepth();
+            d_Q_helmholtz_batch[*it] = b;
+        }
+        std::ostringstream batch_name;
+        batch_name << d_object_name << "::batch_" << b;
+        Pointer<CellVariable<NDIM, double> > batch_sol_var =
+            new CellVariable<NDIM, double>(batch_name.str() + "::sol", batch_depth);
+        int batch_sol_idx;
+        registerVariable(batch_sol_idx, batch_sol_var, cell_ghosts, getScratchContext());
+        d_batch_sol_var.push_back(batch_sol_var);
+        Pointer<CellVariable<NDIM, double> > batch_rhs_var =
+            new CellVariable<NDIM, double>(batch_name.str() + "::rhs", batch_depth);
+        int batch_rhs_idx;
+        registerVariable(batch_rhs_idx, batch_rhs_var, cell_ghosts, getScratchContext());
+        d_batch_rhs_var.push_back(batch_rhs_var);
+    }
+    return;
+} // setupHelmholtzSolveBatches
+
+bool
+AdvDiffSemiImplicitHierarchyIntegrator::isHelmholtzSolveBatchActive(const unsigned int batch_num)
+{
+    const std::vector<unsigned int>& batch = d_helmholtz_batches[batch_num];
+    Pointer<CellVariable<NDIM, double> > Q0_var = d_Q_var[batch.front()];
+    for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[*it];
+        if (d_Q_is_diffusion_coef_variable[Q_var] || (Q_var != Q0_var && d_Q_F_map[Q_var]) ||
+            d_Q_diffusion_time_stepping_type[Q_var] != d_Q_diffusion_time_stepping_type[Q0_var] ||
+            d_Q_diffusion_coef[Q_var] != d_Q_diffusion_coef[Q0_var] ||
+            d_Q_damping_coef[Q_var] != d_Q_damping_coef[Q0_var])
+        {
+            return false;
+        }
+    }
+    return true;
+} // isHelmholtzSolveBatchActive
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::solveHelmholtzSolveBatch(
+    const unsigned int batch_num,
+    const std::vector<TimeSteppingType>& convective_time_stepping_types)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<unsigned int>& batch = d_helmholtz_batches[batch_num];
+
+    // Compare the scales of the right-hand sides of the members of the group.
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    double min_rhs_norm = std::numeric_limits<double>::max();
+    double max_rhs_norm = 0.0;
+    for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+    {
+        const int Q_rhs_scratch_idx =
+            var_db->mapVariableAndContextToIndex(d_Q_Q_rhs_map[d_Q_var[*it]], getScratchContext());
+        const double rhs_norm = d_hier_cc_data_ops->L2Norm(Q_rhs_scratch_idx, wgt_idx);
+        min_rhs_norm = std::min(min_rhs_norm, rhs_norm);
+        max_rhs_norm = std::max(max_rhs_norm, rhs_norm);
+    }
+
+    // Solve the systems individually if their scales differ too much.
+    if (!(max_rhs_norm <= d_batch_helmholtz_max_rhs_norm_ratio * min_rhs_norm) || min_rhs_norm == 0.0)
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::integrateHierarchy(): "
+                 << "solving Helmholtz systems for variable group number " << batch_num << " individually\n";
+        }
+        for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+        {
+            const unsigned int l = *it;
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            if (d_helmholtz_solvers_need_init[l])
+            {
+                helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_solvers_need_init[l] = false;
+            }
+            helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+            completeHelmholtzSolve(l, convective_time_stepping_types[l], helmholtz_solver);
+        }
+        return;
+    }
+
+    // Solve the systems together.  The relative residual of each member is
+    // bounded by sqrt(n)*(max_rhs_norm/min_rhs_norm) times the relative
+    // residual of the combined system, so the relative tolerance of the
+    // combined solve is reduced accordingly.
+    const int batch_sol_idx = var_db->mapVariableAndContextToIndex(d_batch_sol_var[batch_num], getScratchContext());
+    const int batch_rhs_idx = var_db->mapVariableAndContextToIndex(d_batch_rhs_var[batch_num], getScratchContext());
+    copyToHelmholtzSolveBatch(batch_num, batch_sol_idx, /*use_rhs_data*/ false);
+    copyToHelmholtzSolveBatch(batch_num, batch_rhs_idx, /*use_rhs_data*/ true);
+    Pointer<PoissonSolver> helmholtz_solver = d_batch_helmholtz_solvers[batch_num];
+    const double rel_tol = helmholtz_solver->getRelativeTolerance();
+    helmholtz_solver->setRelativeTolerance(rel_tol / (std::sqrt(static_cast<double>(batch.size())) *
+                                                      (max_rhs_norm / min_rhs_norm)));
+    helmholtz_solver->solveSystem(*d_batch_sol_vecs[batch_num], *d_batch_rhs_vecs[batch_num]);
+    helmholtz_solver->setRelativeTolerance(rel_tol);
+    copyFromHelmholtzSolveBatch(batch_num, batch_sol_idx);
+    for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+    {
+        completeHelmholtzSolve(*it, convective_time_stepping_types[*it], helmholtz_solver);
+    }
+    return;
+} // solveHelmholtzSolveBatch
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::copyToHelmholtzSolveBatch(const unsigned int batch_num,
+                                                                  const int batch_idx,
+                                                                  const bool use_rhs_data)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<unsigned int>& batch = d_helmholtz_batches[batch_num];
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_idx);
+            int batch_depth = 0;
+            for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+            {
+                Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[*it];
+                const int Q_idx = var_db->mapVariableAndContextToIndex(use_rhs_data ? d_Q_Q_rhs_map[Q_var] : Q_var,
+                                                                       getScratchContext());
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                for (int d = 0; d < Q_data->getDepth(); ++d, ++batch_depth)
+                {
+                    batch_data->copyDepth(batch_depth, *Q_data, d);
+                }
+            }
+        }
+    }
+    return;
+} // copyToHelmholtzSolveBatch
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::copyFromHelmholtzSolveBatch(const unsigned int batch_num, const int batch_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<unsigned int>& batch = d_helmholtz_batches[batch_num];
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_idx);
+            int batch_depth = 0;
+            for (std::vector<unsigned int>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+            {
+                const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(d_Q_var[*it], getScratchContext());
+                Pointer<CellData<NDIM, double> > Q_scratch_data = patch->getPatchData(Q_scratch_idx);
+                for (int d = 0; d < Q_scratch_data->getDepth(); ++d, ++batch_depth)
+                {
+                    Q_scratch_data->copyDepth(d, *batch_data, batch_depth);
+                }
+            }
+        }
+    }
+    return;
+} // copyFromHelmholtzSolveBatch
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::completeHelmholtzSolve(const unsigned int l,
+                                                               const TimeSteppingType convective_time_stepping_type,
+                                                               Pointer<PoissonSolver> helmholtz_solver)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+    Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
+    Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+    Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+    Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
+
+    const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+    const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+    const int F_scratch_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getScratchContext()) : -1;
+    const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
+    const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
+
+    // Update Q(n+1).
+    d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
+             << helmholtz_solver->getNumIterations() << "\n";
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): diffusion solve residual norm        = "
+             << helmholtz_solver->getResidualNorm() << "\n";
+    if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+    {
+        pout << d_object_name << "::integrateHierarchy():"
+             << "  WARNING: linear solver iterations == max iterations\n";
+    }
+
+    // Reset the right-hand side vector.
+    if (u_var)
+    {
+        const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
+        if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
+        {
+            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +1.0, N_scratch_idx, Q_rhs_scratch_idx);
+        }
+        else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +0.5, N_scratch_idx, Q_rhs_scratch_idx);
+        }
+    }
+    if (d_F_fcn[F_var])
+    {
+        d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_scratch_idx, Q_rhs_scratch_idx);
+        d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+    }
+    return;
+} // completeHelmholtzSolve
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -67,7 +67,6 @@
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
-#include "PatchCellDataOpsReal.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -1453,10 +1452,6 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
     INSHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = new_time - current_time;
-
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
     {
@@ -1465,32 +1460,6 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
         synchronizeHierarchyData(NEW_DATA);
     }
 
-    // Determine the CFL number.
-    if (!d_parent_integrator)
-    {
-        double cfl_max = 0.0;
-        PatchCellDataOpsReal<NDIM, double> patch_cc_ops;
-        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-                const double* const dx = pgeom->getDx();
-                const double dx_min = *(std::min_element(dx, dx + NDIM));
-                Pointer<CellData<NDIM, double> > u_cc_new_data = patch->getPatchData(d_U_new_idx);
-                double u_max = 0.0;
-                u_max = patch_cc_ops.maxNorm(u_cc_new_data, patch_box);
-                cfl_max = std::max(cfl_max, u_max * dt / dx_min);
-            }
-        }
-        cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-        if (d_enable_logging)
-            plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
-    }
-
     // Compute max |Omega|_2.
     if (d_using_vorticity_tagging)
     {
@@ -1681,6 +1650,9 @@ INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Velocity data may have changed on any level of the hierarchy.
+    resetStableTimestepCache();
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -68,6 +69,8 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -456,9 +459,11 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
         d_ghostfill_scheds[ln]->fillData(d_solution_time);
         d_ghostfill_alg->resetSchedule(d_ghostfill_scheds[ln]);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
+            d_workspace.reset();
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
@@ -480,13 +485,13 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
             TBOX_ASSERT(u_extrap_data_gcw.min() == u_extrap_data_gcw.max());
 #endif
             CellData<NDIM, double>& U0_data = *U_data;
-            CellData<NDIM, double> U1_data(patch_box, 1, U_data_gcw);
+            const PatchDataWorkspace::DataView U1_data = d_workspace.getCellData(patch_box, 1, U_data_gcw);
 #if (NDIM == 3)
-            CellData<NDIM, double> U2_data(patch_box, 1, U_data_gcw);
+            const PatchDataWorkspace::DataView U2_data = d_workspace.getCellData(patch_box, 1, U_data_gcw);
 #endif
-            CellData<NDIM, double> dU_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_L_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_R_data(patch_box, 1, U_data_gcw);
+            const PatchDataWorkspace::DataView dU_data = d_workspace.getCellData(patch_box, 1, U_data_gcw);
+            const PatchDataWorkspace::DataView U_L_data = d_workspace.getCellData(patch_box, 1, U_data_gcw);
+            const PatchDataWorkspace::DataView U_R_data = d_workspace.getCellData(patch_box, 1, U_data_gcw);
 
             // Extrapolate from cell centers to cell faces.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
@@ -500,10 +505,10 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
                     U_data_gcw(0),
                     U_data_gcw(1),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1_data.getPointer(0),
+                    dU_data.getPointer(0),
+                    U_L_data.getPointer(0),
+                    U_R_data.getPointer(0),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_extrap_data_gcw(0),
@@ -524,11 +529,11 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
                     U_data_gcw(1),
                     U_data_gcw(2),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    U2_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1_data.getPointer(0),
+                    U2_data.getPointer(0),
+                    dU_data.getPointer(0),
+                    U_L_data.getPointer(0),
+                    U_R_data.getPointer(0),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_ADV_data_gcw(2),
@@ -625,9 +630,10 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
@@ -839,6 +845,21 @@ INSCollocatedPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRe
         d_ghostfill_scheds[ln] = d_ghostfill_alg->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategy);
     }
 
+    // Size the workspace used for patch-local temporary data.
+    size_t workspace_size = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            const size_t patch_workspace_size =
+                (NDIM == 2 ? 4 : 5) * PatchDataWorkspace::getCellDataSize(patch_box, 1, IntVector<NDIM>(GADVECTG));
+            workspace_size = std::max(workspace_size, patch_workspace_size);
+        }
+    }
+    d_workspace.reserve(workspace_size);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -861,6 +882,9 @@ INSCollocatedPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Free the workspace used for patch-local temporary data.
+    d_workspace.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
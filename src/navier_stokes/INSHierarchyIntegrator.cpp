@@ -62,6 +62,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/PoissonSolver.h"
+#include "mpi.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -88,6 +89,7 @@ static const int INS_HIERARCHY_INTEGRATOR_VERSION = 2;
 
 INSHierarchyIntegrator::~INSHierarchyIntegrator()
 {
+    finalizeStableTimestepReduction();
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         delete d_U_star_bc_coefs[d];
@@ -466,6 +468,9 @@ INSHierarchyIntegrator::INSHierarchyIntegrator(const std::string& object_name,
     d_init_convective_time_stepping_type = MIDPOINT_RULE;
     d_num_cycles = 1;
     d_cfl_max = 1.0;
+    d_level_stable_dt_request = MPI_REQUEST_NULL;
+    d_level_stable_dt_reduction_pending = false;
+    d_level_stable_dt_is_valid = false;
     d_using_vorticity_tagging = false;
     d_Omega_max = 0.0;
     d_normalize_pressure = false;
@@ -523,10 +528,32 @@ double
 INSHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
 {
     double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
-    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Use the stable time step sizes computed at the end of the preceding time
+    // step when they are available.  Otherwise, compute them from the current
+    // velocity data using a single reduction for all levels.
+    finalizeStableTimestepReduction();
+    if (!d_level_stable_dt_is_valid || static_cast<int>(d_level_stable_dt.size()) != finest_ln + 1)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(dt, d_cfl_max * getStableTimestep(level));
+        d_level_stable_dt.resize(finest_ln + 1);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            double stable_dt = std::numeric_limits<double>::max();
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                stable_dt = std::min(stable_dt, getStableTimestep(patch));
+            }
+            d_level_stable_dt[ln] = stable_dt;
+        }
+        SAMRAI_MPI::minReduction(&d_level_stable_dt[0], finest_ln + 1);
+        d_level_stable_dt_is_valid = true;
+    }
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        dt = std::min(dt, d_cfl_max * d_level_stable_dt[ln]);
     }
     return dt;
 } // getMaximumTimeStepSizeSpecialized
@@ -544,6 +571,75 @@ INSHierarchyIntegrator::getStableTimestep(Pointer<PatchLevel<NDIM> > level) cons
     return stable_dt;
 } // getStableTimestep
 
+void
+INSHierarchyIntegrator::resetTimeDependentHierarchyDataSpecialized(const double new_time)
+{
+    HierarchyIntegrator::resetTimeDependentHierarchyDataSpecialized(new_time);
+
+    // Determine the local stable time step sizes from the updated velocity
+    // data and initiate their reduction.  The result is not needed until the
+    // size of the next time step is determined.
+    finalizeStableTimestepReduction();
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_level_stable_dt_local.resize(finest_ln + 1);
+    d_level_stable_dt.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        double stable_dt = std::numeric_limits<double>::max();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            stable_dt = std::min(stable_dt, getStableTimestep(patch));
+        }
+        d_level_stable_dt_local[ln] = stable_dt;
+    }
+    if (SAMRAI_MPI::usingMPI())
+    {
+#if (MPI_VERSION >= 3)
+        MPI_Iallreduce(&d_level_stable_dt_local[0],
+                       &d_level_stable_dt[0],
+                       finest_ln + 1,
+                       MPI_DOUBLE,
+                       MPI_MIN,
+                       SAMRAI_MPI::getCommunicator(),
+                       &d_level_stable_dt_request);
+        d_level_stable_dt_reduction_pending = true;
+#else
+        MPI_Allreduce(&d_level_stable_dt_local[0],
+                      &d_level_stable_dt[0],
+                      finest_ln + 1,
+                      MPI_DOUBLE,
+                      MPI_MIN,
+                      SAMRAI_MPI::getCommunicator());
+#endif
+    }
+    else
+    {
+        d_level_stable_dt = d_level_stable_dt_local;
+    }
+    d_level_stable_dt_is_valid = true;
+
+    // Report the CFL number of the completed time step.  NOTE: This requires
+    // completing the reduction immediately.
+    if (d_enable_logging)
+    {
+        finalizeStableTimestepReduction();
+        const double stable_dt = *std::min_element(d_level_stable_dt.begin(), d_level_stable_dt.end());
+        plog << d_object_name << "::resetTimeDependentHierarchyDataSpecialized(): CFL number = "
+             << d_dt_previous.front() / stable_dt << "\n";
+    }
+    return;
+} // resetTimeDependentHierarchyDataSpecialized
+
+void
+INSHierarchyIntegrator::resetStableTimestepCache()
+{
+    finalizeStableTimestepReduction();
+    d_level_stable_dt_is_valid = false;
+    return;
+} // resetStableTimestepCache
+
 void
 INSHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 {
@@ -584,6 +680,15 @@ INSHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+INSHierarchyIntegrator::finalizeStableTimestepReduction()
+{
+    if (!d_level_stable_dt_reduction_pending) return;
+    MPI_Wait(&d_level_stable_dt_request, MPI_STATUS_IGNORE);
+    d_level_stable_dt_reduction_pending = false;
+    return;
+} // finalizeStableTimestepReduction
+
 void
 INSHierarchyIntegrator::getFromInput(Pointer<Database> db, const bool is_from_restart)
 {
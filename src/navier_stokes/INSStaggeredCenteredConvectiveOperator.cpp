@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -59,6 +60,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ParallelPatchFor.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -305,7 +307,8 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated by initializeOperatorState().  Reallocate
+    // any data freed by other operators that share the scratch variables.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -338,9 +341,10 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -481,16 +485,6 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (level->checkAllocated(d_U_scratch_idx))
-        {
-            level->deallocatePatchData(d_U_scratch_idx);
-        }
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -535,6 +529,17 @@ INSStaggeredCenteredConvectiveOperator::initializeOperatorState(const SAMRAIVect
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.  The data are retained until the operator state
+    // is deallocated, i.e., until the hierarchy configuration changes.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -552,6 +557,16 @@ INSStaggeredCenteredConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx))
+        {
+            level->deallocatePatchData(d_U_scratch_idx);
+        }
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
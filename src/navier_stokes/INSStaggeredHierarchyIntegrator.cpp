@@ -71,7 +71,6 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
-#include "PatchSideDataOpsReal.h"
 #include "PoissonSpecifications.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
@@ -113,6 +112,7 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/KrylovLinearSolver.h"
+#include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PoissonSolver.h"
@@ -530,6 +530,44 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Setup the solution history used to extrapolate initial guesses for the
+    // Stokes solver.
+    d_initial_guess_extrapolation_type = "NONE";
+    d_solution_history_size = 3;
+    if (input_db->keyExists("initial_guess_extrapolation_type"))
+        d_initial_guess_extrapolation_type = input_db->getString("initial_guess_extrapolation_type");
+    if (input_db->keyExists("solution_history_size"))
+        d_solution_history_size = input_db->getInteger("solution_history_size");
+    if (d_initial_guess_extrapolation_type != "NONE" && d_initial_guess_extrapolation_type != "POLYNOMIAL" &&
+        d_initial_guess_extrapolation_type != "LEAST_SQUARES")
+    {
+        TBOX_ERROR(d_object_name << "::INSStaggeredHierarchyIntegrator():\n"
+                                 << "  unsupported initial guess extrapolation type: "
+                                 << d_initial_guess_extrapolation_type
+                                 << " \n"
+                                 << "  valid choices are: NONE, POLYNOMIAL, LEAST_SQUARES\n");
+    }
+    if (d_solution_history_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::INSStaggeredHierarchyIntegrator():\n"
+                                 << "  solution_history_size must be positive\n");
+    }
+
+    // Setup the policy used to determine when to reinitialize the solvers
+    // following changes in the time step size.
+    d_lag_solver_reinitialization = false;
+    d_solver_reinit_rel_change_tol = 0.25;
+    d_solver_reinit_iteration_growth_factor = 1.5;
+    if (input_db->keyExists("lag_solver_reinitialization"))
+        d_lag_solver_reinitialization = input_db->getBool("lag_solver_reinitialization");
+    if (input_db->keyExists("solver_reinit_rel_change_tol"))
+        d_solver_reinit_rel_change_tol = input_db->getDouble("solver_reinit_rel_change_tol");
+    if (input_db->keyExists("solver_reinit_iteration_growth_factor"))
+        d_solver_reinit_iteration_growth_factor = input_db->getDouble("solver_reinit_iteration_growth_factor");
+    d_solver_init_U_problem_C = std::numeric_limits<double>::quiet_NaN();
+    d_solver_init_num_iterations = -1;
+    d_solver_convergence_degraded = false;
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -584,6 +622,7 @@ INSStaggeredHierarchyIntegrator::~INSStaggeredHierarchyIntegrator()
     if (d_U_rhs_vec) d_U_rhs_vec->freeVectorComponents();
     if (d_U_adv_vec) d_U_adv_vec->freeVectorComponents();
     if (d_N_vec) d_N_vec->freeVectorComponents();
+    if (d_U_err_vec) d_U_err_vec->freeVectorComponents();
     if (d_P_rhs_vec) d_P_rhs_vec->freeVectorComponents();
     for (unsigned int k = 0; k < d_nul_vecs.size(); ++k)
     {
@@ -593,6 +632,7 @@ INSStaggeredHierarchyIntegrator::~INSStaggeredHierarchyIntegrator()
     {
         if (d_U_nul_vecs[k]) d_U_nul_vecs[k]->freeVectorComponents();
     }
+    clearSolutionHistory();
     return;
 } // ~INSStaggeredHierarchyIntegrator
 
@@ -1096,6 +1136,21 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
         d_N_vec->allocateVectorData(current_time);
         d_N_vec->setToScalar(0.0);
     }
+    if (usingAdaptiveTimeStepping())
+    {
+        if (d_current_num_cycles > 1)
+        {
+            d_U_err_vec->allocateVectorData(current_time);
+        }
+        else
+        {
+            IBAMR_DO_ONCE(
+                {
+                    pout << "INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy():\n"
+                         << "  WARNING: adaptive time stepping requires num_cycles > 1 to estimate the error.\n";
+                });
+        }
+    }
 
     // Cache BC data.
     d_bc_helper->cacheBcCoefData(d_bc_coefs, new_time, d_hierarchy);
@@ -1274,8 +1329,31 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Setup the solution and right-hand-side vectors.
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
+    // Extrapolate the initial guess from the solutions of the preceding time
+    // steps.  Subsequent cycles start from the previous cycle's solution.
+    if (cycle_num == 0 && !d_sol_history_vecs.empty())
+    {
+        extrapolateInitialGuess(d_sol_vec, d_rhs_vec, current_time, new_time);
+    }
+
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+
+    // Keep track of the convergence of the Stokes solver when the
+    // reinitialization of the solver is lagged.
+    if (d_lag_solver_reinitialization)
+    {
+        const int num_iterations = d_stokes_solver->getNumIterations();
+        if (d_solver_init_num_iterations < 0)
+        {
+            d_solver_init_num_iterations = num_iterations;
+        }
+        else if (num_iterations > 1 &&
+                 num_iterations > d_solver_reinit_iteration_growth_factor * d_solver_init_num_iterations)
+        {
+            d_solver_convergence_degraded = true;
+        }
+    }
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -1289,6 +1367,11 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Reset the solution and right-hand-side vectors.
     resetSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
+    // Keep the velocity computed in the first cycle for use in estimating the
+    // error of the time step.
+    const int U_err_idx = d_U_err_vec->getComponentDescriptorIndex(0);
+    if (cycle_num == 0 && isAllocatedPatchData(U_err_idx)) d_hier_sc_data_ops->copyData(U_err_idx, d_U_new_idx);
+
     // Update the state variables of any linked advection-diffusion solver.
     if (d_adv_diff_hier_integrator)
     {
@@ -1341,10 +1424,6 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
     INSHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = new_time - current_time;
-
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
     {
@@ -1353,32 +1432,6 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         synchronizeHierarchyData(NEW_DATA);
     }
 
-    // Determine the CFL number.
-    if (!d_parent_integrator)
-    {
-        double cfl_max = 0.0;
-        PatchSideDataOpsReal<NDIM, double> patch_sc_ops;
-        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-                const double* const dx = pgeom->getDx();
-                const double dx_min = *(std::min_element(dx, dx + NDIM));
-                Pointer<SideData<NDIM, double> > u_sc_new_data = patch->getPatchData(d_U_new_idx);
-                double u_max = 0.0;
-                u_max = patch_sc_ops.maxNorm(u_sc_new_data, patch_box);
-                cfl_max = std::max(cfl_max, u_max * dt / dx_min);
-            }
-        }
-        cfl_max = SAMRAI_MPI::maxReduction(cfl_max);
-        if (d_enable_logging)
-            plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
-    }
-
     // Compute max |Omega|_2.
     if (d_using_vorticity_tagging)
     {
@@ -1396,6 +1449,10 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
 #endif
     }
 
+    // Store the new solution for use in extrapolating subsequent initial
+    // guesses.
+    if (d_initial_guess_extrapolation_type != "NONE") updateSolutionHistory(current_time, new_time);
+
     // Deallocate scratch data.
     d_U_rhs_vec->deallocateVectorData();
     d_P_rhs_vec->deallocateVectorData();
@@ -1404,6 +1461,7 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         d_U_adv_vec->deallocateVectorData();
         d_N_vec->deallocateVectorData();
     }
+    if (isAllocatedPatchData(d_U_err_vec->getComponentDescriptorIndex(0))) d_U_err_vec->deallocateVectorData();
 
     // Deallocate any registered advection-diffusion solver.
     if (d_adv_diff_hier_integrator)
@@ -1899,6 +1957,9 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Velocity data may have changed on any level of the hierarchy.
+    resetStableTimestepCache();
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -1958,6 +2019,10 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+
+    // Solutions stored on the old hierarchy cannot be used to extrapolate
+    // initial guesses on the new hierarchy.
+    clearSolutionHistory();
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -2243,6 +2308,44 @@ INSStaggeredHierarchyIntegrator::getStableTimestep(Pointer<Patch<NDIM> > patch)
     return stable_dt;
 } // getStableTimestep
 
+double
+INSStaggeredHierarchyIntegrator::getTimeStepErrorEstimateSpecialized()
+{
+    const int U_err_idx = d_U_err_vec->getComponentDescriptorIndex(0);
+    if (!isAllocatedPatchData(U_err_idx)) return 0.0;
+
+    // The difference between the first-cycle and final-cycle velocities
+    // estimates the error of the lower-order predictor step, which is used as
+    // a (conservative) estimate of the error of the time step.
+    const int wgt_sc_idx = d_hier_math_ops->getSideWeightPatchDescriptorIndex();
+    d_hier_sc_data_ops->subtract(U_err_idx, d_U_new_idx, U_err_idx);
+    const double U_err_max = d_hier_sc_data_ops->maxNorm(U_err_idx, wgt_sc_idx);
+    const double U_new_max = d_hier_sc_data_ops->maxNorm(d_U_new_idx, wgt_sc_idx);
+
+    // Restore the first-cycle velocity so that repeated calls return the same
+    // estimate.
+    d_hier_sc_data_ops->subtract(U_err_idx, d_U_new_idx, U_err_idx);
+    return U_err_max / std::max(U_new_max, std::sqrt(std::numeric_limits<double>::epsilon()));
+} // getTimeStepErrorEstimateSpecialized
+
+void
+INSStaggeredHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized()
+{
+    // Deallocate the solver vectors that are allocated by
+    // preprocessIntegrateHierarchy().
+    d_U_rhs_vec->deallocateVectorData();
+    d_P_rhs_vec->deallocateVectorData();
+    if (!d_creeping_flow)
+    {
+        d_U_adv_vec->deallocateVectorData();
+        d_N_vec->deallocateVectorData();
+    }
+    if (isAllocatedPatchData(d_U_err_vec->getComponentDescriptorIndex(0))) d_U_err_vec->deallocateVectorData();
+
+    INSHierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized();
+    return;
+} // resetIntegratorToPreadvanceStateSpecialized
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -2282,12 +2385,29 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
 
     // Ensure that solver components are appropriately reinitialized when the
     // time step size changes.
+    //
+    // NOTE: When reinitialization is lagged, the solvers continue to use the
+    // updated problem coefficients, but the preconditioners are only rebuilt
+    // when the coefficients change substantially or when the convergence of
+    // the Stokes solver degrades.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    bool solver_reinit = dt_change;
+    if (dt_change && !initial_time && d_lag_solver_reinitialization)
+    {
+        const double C = U_problem_coefs.getCConstant();
+        const double C_rel_change = std::abs(C - d_solver_init_U_problem_C) /
+                                    std::max(std::abs(d_solver_init_U_problem_C), std::numeric_limits<double>::min());
+        solver_reinit = !(C_rel_change <= d_solver_reinit_rel_change_tol);
+    }
+    if (d_lag_solver_reinitialization && d_solver_convergence_degraded) solver_reinit = true;
+    if (solver_reinit)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
     }
+    if (d_enable_logging && dt_change && !solver_reinit)
+        plog << d_object_name << "::preprocessIntegrateHierarchy(): reusing solver and preconditioner from preceding "
+                                 "time step\n";
 
     // Setup solver vectors.
     const bool has_velocity_nullspace = d_normalize_velocity && MathUtilities<double>::equalEps(rho, 0.0);
@@ -2305,11 +2425,13 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         if (d_U_rhs_vec) d_U_rhs_vec->freeVectorComponents();
         if (d_U_adv_vec) d_U_adv_vec->freeVectorComponents();
         if (d_N_vec) d_N_vec->freeVectorComponents();
+        if (d_U_err_vec) d_U_err_vec->freeVectorComponents();
         if (d_P_rhs_vec) d_P_rhs_vec->freeVectorComponents();
 
         d_U_rhs_vec = d_U_scratch_vec->cloneVector(d_object_name + "::U_rhs_vec");
         d_U_adv_vec = d_U_scratch_vec->cloneVector(d_object_name + "::U_adv_vec");
         d_N_vec = d_U_scratch_vec->cloneVector(d_object_name + "::N_vec");
+        d_U_err_vec = d_U_scratch_vec->cloneVector(d_object_name + "::U_err_vec");
         d_P_rhs_vec = d_P_scratch_vec->cloneVector(d_object_name + "::P_rhs_vec");
 
         d_sol_vec =
@@ -2524,6 +2646,9 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         }
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
         d_stokes_solver_needs_init = false;
+        d_solver_init_U_problem_C = U_problem_coefs.getCConstant();
+        d_solver_init_num_iterations = -1;
+        d_solver_convergence_degraded = false;
     }
     return;
 } // reinitializeOperatorsAndSolvers
@@ -2733,6 +2858,171 @@ INSStaggeredHierarchyIntegrator::getConvectiveTimeSteppingType(const int cycle_n
     return convective_time_stepping_type;
 } // getConvectiveTimeSteppingType
 
+void
+INSStaggeredHierarchyIntegrator::extrapolateInitialGuess(const Pointer<SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                                         const Pointer<SAMRAIVectorReal<NDIM, double> >& rhs_vec,
+                                                         const double current_time,
+                                                         const double new_time)
+{
+    const int n_hist = static_cast<int>(d_sol_history_vecs.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(n_hist > 0);
+#endif
+
+    // The least-squares extrapolation requires access to the Stokes operator.
+    Pointer<LinearOperator> A;
+    if (d_initial_guess_extrapolation_type == "LEAST_SQUARES")
+    {
+        KrylovLinearSolver* p_stokes_krylov_solver = dynamic_cast<KrylovLinearSolver*>(d_stokes_solver.getPointer());
+        if (p_stokes_krylov_solver) A = p_stokes_krylov_solver->getOperator();
+        if (!A)
+        {
+            IBAMR_DO_ONCE(
+                {
+                    pout << "INSStaggeredHierarchyIntegrator::extrapolateInitialGuess():\n"
+                         << "  WARNING: least-squares extrapolation requires a Krylov Stokes solver;\n"
+                         << "  using polynomial extrapolation instead.\n";
+                });
+        }
+    }
+
+    if (!A)
+    {
+        // Lagrange extrapolation in time of the stored velocity and pressure
+        // fields.  The pressure is stored at the midpoints of the time
+        // intervals.
+        const double half_time = 0.5 * (current_time + new_time);
+        const int U_sol_idx = sol_vec->getComponentDescriptorIndex(0);
+        const int P_sol_idx = sol_vec->getComponentDescriptorIndex(1);
+        d_hier_sc_data_ops->setToScalar(U_sol_idx, 0.0);
+        d_hier_cc_data_ops->setToScalar(P_sol_idx, 0.0);
+        for (int i = 0; i < n_hist; ++i)
+        {
+            double U_wgt = 1.0, P_wgt = 1.0;
+            for (int j = 0; j < n_hist; ++j)
+            {
+                if (j == i) continue;
+                U_wgt *= (new_time - d_U_history_times[j]) / (d_U_history_times[i] - d_U_history_times[j]);
+                P_wgt *= (half_time - d_P_history_times[j]) / (d_P_history_times[i] - d_P_history_times[j]);
+            }
+            d_hier_sc_data_ops->axpy(
+                U_sol_idx, U_wgt, d_sol_history_vecs[i]->getComponentDescriptorIndex(0), U_sol_idx);
+            d_hier_cc_data_ops->axpy(
+                P_sol_idx, P_wgt, d_sol_history_vecs[i]->getComponentDescriptorIndex(1), P_sol_idx);
+        }
+        return;
+    }
+
+    // Allocate workspace.
+    if (!d_extrap_res_vec)
+    {
+        d_extrap_res_vec = sol_vec->cloneVector(d_object_name + "::extrap_res_vec");
+        d_extrap_res_vec->allocateVectorData(current_time);
+    }
+    while (static_cast<int>(d_extrap_basis_vecs.size()) < n_hist)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, double> > basis_vec =
+            sol_vec->cloneVector(d_object_name + "::extrap_basis_vec");
+        basis_vec->allocateVectorData(current_time);
+        d_extrap_basis_vecs.push_back(basis_vec);
+        Pointer<SAMRAIVectorReal<NDIM, double> > image_vec =
+            sol_vec->cloneVector(d_object_name + "::extrap_image_vec");
+        image_vec->allocateVectorData(current_time);
+        d_extrap_image_vecs.push_back(image_vec);
+    }
+
+    // Compute the residual of the current approximation x0 = [u(n);p(n-1/2)].
+    const bool homogeneous_bc = A->getHomogeneousBc();
+    A->setHomogeneousBc(false);
+    A->apply(*sol_vec, *d_extrap_res_vec);
+    d_extrap_res_vec->subtract(rhs_vec, d_extrap_res_vec);
+
+    // Find the combination x = x0 + sum_i c_i (x_i - x0) of the stored
+    // solutions x_i that minimizes the residual.  The images A (x_i - x0) are
+    // orthonormalized by modified Gram-Schmidt, and the same transformation
+    // is applied to the search directions x_i - x0.
+    A->setHomogeneousBc(true);
+    int n_basis = 0;
+    for (int i = n_hist - 1; i >= 0; --i)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_vec = d_extrap_basis_vecs[n_basis];
+        Pointer<SAMRAIVectorReal<NDIM, double> > w_vec = d_extrap_image_vecs[n_basis];
+        u_vec->subtract(d_sol_history_vecs[i], sol_vec);
+        A->apply(*u_vec, *w_vec);
+        const double w_norm_init = std::sqrt(w_vec->dot(w_vec));
+        if (w_norm_init <= std::numeric_limits<double>::epsilon()) continue;
+        for (int j = 0; j < n_basis; ++j)
+        {
+            const double h = d_extrap_image_vecs[j]->dot(w_vec);
+            w_vec->axpy(-h, d_extrap_image_vecs[j], w_vec);
+            u_vec->axpy(-h, d_extrap_basis_vecs[j], u_vec);
+        }
+        const double w_norm = std::sqrt(w_vec->dot(w_vec));
+        if (w_norm <= 1.0e-8 * w_norm_init) continue;
+        w_vec->scale(1.0 / w_norm, w_vec);
+        u_vec->scale(1.0 / w_norm, u_vec);
+        ++n_basis;
+    }
+    A->setHomogeneousBc(homogeneous_bc);
+    for (int j = 0; j < n_basis; ++j)
+    {
+        const double c = d_extrap_image_vecs[j]->dot(d_extrap_res_vec);
+        sol_vec->axpy(c, d_extrap_basis_vecs[j], sol_vec);
+    }
+    if (d_enable_logging)
+        plog << d_object_name << "::extrapolateInitialGuess(): least-squares extrapolation using " << n_basis
+             << " of " << n_hist << " stored solutions\n";
+    return;
+} // extrapolateInitialGuess
+
+void
+INSStaggeredHierarchyIntegrator::updateSolutionHistory(const double current_time, const double new_time)
+{
+    // Reuse the storage of the oldest stored solution once the history is
+    // full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > hist_vec;
+    if (static_cast<int>(d_sol_history_vecs.size()) < d_solution_history_size)
+    {
+        hist_vec = d_sol_vec->cloneVector(d_object_name + "::sol_history_vec");
+        hist_vec->allocateVectorData(new_time);
+    }
+    else
+    {
+        hist_vec = d_sol_history_vecs.front();
+        d_sol_history_vecs.pop_front();
+        d_U_history_times.pop_front();
+        d_P_history_times.pop_front();
+    }
+    d_hier_sc_data_ops->copyData(hist_vec->getComponentDescriptorIndex(0), d_U_new_idx);
+    d_hier_cc_data_ops->copyData(hist_vec->getComponentDescriptorIndex(1), d_P_new_idx);
+    d_sol_history_vecs.push_back(hist_vec);
+    d_U_history_times.push_back(new_time);
+    d_P_history_times.push_back(0.5 * (current_time + new_time));
+    return;
+} // updateSolutionHistory
+
+void
+INSStaggeredHierarchyIntegrator::clearSolutionHistory()
+{
+    for (unsigned int k = 0; k < d_sol_history_vecs.size(); ++k)
+    {
+        d_sol_history_vecs[k]->freeVectorComponents();
+    }
+    d_sol_history_vecs.clear();
+    d_U_history_times.clear();
+    d_P_history_times.clear();
+    if (d_extrap_res_vec) d_extrap_res_vec->freeVectorComponents();
+    d_extrap_res_vec.setNull();
+    for (unsigned int k = 0; k < d_extrap_basis_vecs.size(); ++k)
+    {
+        d_extrap_basis_vecs[k]->freeVectorComponents();
+        d_extrap_image_vecs[k]->freeVectorComponents();
+    }
+    d_extrap_basis_vecs.clear();
+    d_extrap_image_vecs.clear();
+    return;
+} // clearSolutionHistory
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -33,13 +33,15 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
 #include "IBAMR_config.h"
 #include "Index.h"
 #include "IntVector.h"
@@ -62,6 +64,8 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -462,6 +466,411 @@ static Timer* t_apply_convective_operator;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// NOTE: The fused kernel evaluates the operator one tile of the patch at a
+// time.  The tile extents are chosen so that the extrapolated face values of
+// all of the velocity components on a tile remain resident in cache.
+#if (NDIM == 2)
+static const int PPM_TILE_SIZE[NDIM] = { 32, 16 };
+static const int PPM_TILE_DATA_SIZE = NDIM * NDIM * (PPM_TILE_SIZE[0] + 2) * (PPM_TILE_SIZE[1] + 2);
+#endif
+#if (NDIM == 3)
+static const int PPM_TILE_SIZE[NDIM] = { 16, 8, 4 };
+static const int PPM_TILE_DATA_SIZE =
+    NDIM * NDIM * (PPM_TILE_SIZE[0] + 2) * (PPM_TILE_SIZE[1] + 2) * (PPM_TILE_SIZE[2] + 2);
+#endif
+static const int PPM_MAX_LINE_SIZE = 32 + 2;
+
+inline int
+array_stride(const ArrayData<NDIM, double>& data, const int axis)
+{
+    const Box<NDIM>& data_box = data.getBox();
+    int stride = 1;
+    for (int d = 0; d < axis; ++d)
+    {
+        stride *= data_box.numberCells(d);
+    }
+    return stride;
+} // array_stride
+
+inline int
+array_offset(const Index<NDIM>& i, const Index<NDIM>& lower, const int* const stride)
+{
+    int offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - lower(d)) * stride[d];
+    }
+    return offset;
+} // array_offset
+
+// Helper functions that mirror those of the Fortran xsPPM7 implementation in
+// advect_predictors.f.m4.  The order of operations is kept the same so that
+// both implementations produce identical results.
+inline double
+minmod(const double a, const double b)
+{
+    return 0.5 * ((a >= 0.0 ? 0.5 : -0.5) + (b >= 0.0 ? 0.5 : -0.5)) * (std::abs(a + b) - std::abs(a - b));
+} // minmod
+
+inline double
+median(const double a, const double b, const double c)
+{
+    return a + minmod(b - a, c - a);
+} // median
+
+inline void
+monotonize(const double Q_m,
+           const double Q,
+           const double Q_p,
+           const double Q_L,
+           const double Q_R,
+           double& Q_star_L,
+           double& Q_star_R)
+{
+    const double Q_L_tmp = median(Q, Q_L, Q_m);
+    const double Q_R_tmp = median(Q, Q_R, Q_p);
+    Q_star_L = median(Q, Q_L_tmp, 3.0 * Q - 2.0 * Q_R_tmp);
+    Q_star_R = median(Q, Q_R_tmp, 3.0 * Q - 2.0 * Q_L_tmp);
+    return;
+} // monotonize
+
+inline double
+sign_eps(const double x)
+{
+    static const double EPSILON = 1.0e-8;
+    if (std::abs(x) <= EPSILON) return 0.0;
+    return (x >= EPSILON ? 1.0 : -1.0);
+} // sign_eps
+
+inline double
+sqr(const double x)
+{
+    return x * x;
+} // sqr
+
+// Compute the WENO5 interpolant of Q[0],...,Q[4], which are the values in
+// cells -2,...,+2 relative to the cell being reconstructed.
+double
+weno5_interp(const double* const Q)
+{
+    const double f[3] = { (11.0 * Q[2] - 7.0 * Q[1] + 2.0 * Q[0]) / 6.0,
+                          (2.0 * Q[3] + 5.0 * Q[2] - Q[1]) / 6.0,
+                          (-Q[4] + 5.0 * Q[3] + 2.0 * Q[2]) / 6.0 };
+    const double IS[3] = {
+        (13.0 / 12.0) * sqr(Q[2] - 2.0 * Q[1] + Q[0]) + 0.25 * sqr(3.0 * Q[2] - 4.0 * Q[1] + Q[0]),
+        (13.0 / 12.0) * sqr(Q[3] - 2.0 * Q[2] + Q[1]) + 0.25 * sqr(Q[3] - Q[1]),
+        (13.0 / 12.0) * sqr(Q[4] - 2.0 * Q[3] + Q[2]) + 0.25 * sqr(Q[4] - 4.0 * Q[3] + 3.0 * Q[2])
+    };
+    static const double omega_bar[3] = { 0.1, 0.6, 0.3 };
+    double alpha[3], omega[3];
+    double alpha_sum = 0.0;
+    for (int i = 0; i < 3; ++i)
+    {
+        alpha[i] = omega_bar[i] / (IS[i] + 1.0e-40);
+        alpha_sum += alpha[i];
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        omega[i] = alpha[i] / alpha_sum;
+    }
+
+    // Improve the accuracy of the weights (following the approach of Henrick,
+    // Aslam, and Powers).
+    double omega_sum = 0.0;
+    for (int i = 0; i < 3; ++i)
+    {
+        omega[i] = omega[i] * (omega_bar[i] + sqr(omega_bar[i]) - 3.0 * omega_bar[i] * omega[i] + sqr(omega[i])) /
+                   (sqr(omega_bar[i]) + omega[i] * (1.0 - 2.0 * omega_bar[i]));
+        omega_sum += omega[i];
+    }
+    double interp = 0.0;
+    for (int i = 0; i < 3; ++i)
+    {
+        interp += (omega[i] / omega_sum) * f[i];
+    }
+    return interp;
+} // weno5_interp
+
+// Compute the upwinded xsPPM7 values of Q on a line of n_faces faces.  Face f
+// separates cells f-1 and f, Q points to the value in cell 0, and the upwind
+// direction is determined by the average of u_lower and u_upper.  All of the
+// intermediate values are kept in line-local arrays.
+void
+xsppm7_extrapolate_line(double* const q_half,
+                        const int q_half_stride,
+                        const double* const Q,
+                        const int Q_stride,
+                        const double* const u_lower,
+                        const double* const u_upper,
+                        const int u_stride,
+                        const int n_faces)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(n_faces <= PPM_MAX_LINE_SIZE);
+#endif
+    // Compute the limited slopes in cells -2,...,n_faces.
+    double dQ[PPM_MAX_LINE_SIZE + 3];
+    for (int j = -2; j <= n_faces; ++j)
+    {
+        const double Q_m = Q[(j - 1) * Q_stride];
+        const double Q_c = Q[j * Q_stride];
+        const double Q_p = Q[(j + 1) * Q_stride];
+        const double dQ_C = 0.5 * (Q_p - Q_m);
+        const double dQ_L = Q_c - Q_m;
+        const double dQ_R = Q_p - Q_c;
+        if (dQ_R * dQ_L > 1.0e-12)
+        {
+            dQ[j + 2] = std::min(std::abs(dQ_C), std::min(2.0 * std::abs(dQ_L), 2.0 * std::abs(dQ_R))) *
+                        (dQ_C >= 0.0 ? 1.0 : -1.0);
+        }
+        else
+        {
+            dQ[j + 2] = 0.0;
+        }
+    }
+
+    // Compute the limited edge values in cells -1,...,n_faces-1.
+    double Q_L[PPM_MAX_LINE_SIZE + 1], Q_R[PPM_MAX_LINE_SIZE + 1];
+    for (int j = -1; j < n_faces; ++j)
+    {
+        double Q_s[7];
+        for (int k = 0; k < 7; ++k)
+        {
+            Q_s[k] = Q[(j + k - 3) * Q_stride];
+        }
+        const double QQ = Q_s[3];
+        const double QQ_L = (1.0 / 420.0) * (-3.0 * Q_s[6] + 25.0 * Q_s[5] - 101.0 * Q_s[4] + 319.0 * Q_s[3] +
+                                             214.0 * Q_s[2] - 38.0 * Q_s[1] + 4.0 * Q_s[0]);
+        const double QQ_R = (1.0 / 420.0) * (-3.0 * Q_s[0] + 25.0 * Q_s[1] - 101.0 * Q_s[2] + 319.0 * Q_s[3] +
+                                             214.0 * Q_s[4] - 38.0 * Q_s[5] + 4.0 * Q_s[6]);
+        Q_L[j + 1] = QQ_L;
+        Q_R[j + 1] = QQ_R;
+
+        // Check for extrema or violations of monotonicity.
+        double QQ_star_L, QQ_star_R;
+        monotonize(Q_s[2], QQ, Q_s[4], QQ_L, QQ_R, QQ_star_L, QQ_star_R);
+        if (sqr(QQ_star_L - QQ_L) >= 1.0e-12 || sqr(QQ_star_R - QQ_R) >= 1.0e-12)
+        {
+            const double Q_WENO_L[5] = { Q_s[5], Q_s[4], Q_s[3], Q_s[2], Q_s[1] };
+            double QQ_WENO_L = weno5_interp(Q_WENO_L);
+            double QQ_WENO_R = weno5_interp(&Q_s[1]);
+            if (sqr(QQ_star_L - QQ) <= 1.0e-12 || sqr(QQ_star_R - QQ) <= 1.0e-12)
+            {
+                QQ_WENO_L = median(QQ, QQ_WENO_L, QQ_L);
+                QQ_WENO_R = median(QQ, QQ_WENO_R, QQ_R);
+                monotonize(Q_s[2], QQ, Q_s[4], QQ_WENO_L, QQ_WENO_R, QQ_star_L, QQ_star_R);
+            }
+            else
+            {
+                double QQ_4th_L = 0.5 * (Q_s[2] + Q_s[3]) - (1.0 / 6.0) * (dQ[j + 2] - dQ[j + 1]);
+                double QQ_4th_R = 0.5 * (Q_s[3] + Q_s[4]) - (1.0 / 6.0) * (dQ[j + 3] - dQ[j + 2]);
+                QQ_4th_L = median(QQ_4th_L, QQ_WENO_L, QQ_L);
+                QQ_4th_R = median(QQ_4th_R, QQ_WENO_R, QQ_R);
+                monotonize(Q_s[2], QQ, Q_s[4], QQ_4th_L, QQ_4th_R, QQ_star_L, QQ_star_R);
+            }
+            Q_L[j + 1] = median(QQ_WENO_L, QQ_star_L, QQ_L);
+            Q_R[j + 1] = median(QQ_WENO_R, QQ_star_R, QQ_R);
+        }
+    }
+
+    // Evaluate the parabolic profiles on either side of each face and select
+    // the upwind value.
+    for (int f = 0; f < n_faces; ++f)
+    {
+        double QQ = Q[(f - 1) * Q_stride];
+        double P0 = 1.5 * QQ - 0.25 * (Q_L[f] + Q_R[f]);
+        double P1 = Q_R[f] - Q_L[f];
+        double P2 = 3.0 * (Q_L[f] + Q_R[f]) - 6.0 * QQ;
+        const double QQ_L = P0 + 0.5 * P1 + 0.25 * P2;
+
+        QQ = Q[f * Q_stride];
+        P0 = 1.5 * QQ - 0.25 * (Q_L[f + 1] + Q_R[f + 1]);
+        P1 = Q_R[f + 1] - Q_L[f + 1];
+        P2 = 3.0 * (Q_L[f + 1] + Q_R[f + 1]) - 6.0 * QQ;
+        const double QQ_R = P0 - 0.5 * P1 + 0.25 * P2;
+
+        const double u = 0.5 * (u_lower[f * u_stride] + u_upper[f * u_stride]);
+        q_half[f * q_half_stride] = 0.5 * (QQ_L + QQ_R) + sign_eps(u) * 0.5 * (QQ_L - QQ_R);
+    }
+    return;
+} // xsppm7_extrapolate_line
+
+// Compute the convective derivative N of the side-centered velocity U in a
+// single pass over the tiles of the patch.  For each tile, the velocity
+// components are extrapolated to the faces of the control volumes centered
+// about the components of U, and the result is differenced while those face
+// values are in cache.  The advection velocity on each control volume face is
+// the upwinded value of the velocity component normal to that face, which is
+// the same face value that is used for the transport of that component.
+void
+apply_fused_ppm_convective_operator(SideData<NDIM, double>& N_data,
+                                    const SideData<NDIM, double>& U_data,
+                                    const Box<NDIM>& patch_box,
+                                    const double* const dx,
+                                    const ConvectiveDifferencingType difference_form,
+                                    double* const tile_data)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getGhostCellWidth().min() >= GADVECTG);
+#endif
+    const double* U[NDIM];
+    double* N[NDIM];
+    int U_stride[NDIM][NDIM], N_stride[NDIM][NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        U[axis] = U_data.getPointer(axis);
+        N[axis] = N_data.getPointer(axis);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_stride[axis][d] = array_stride(U_data.getArrayData(axis), d);
+            N_stride[axis][d] = array_stride(N_data.getArrayData(axis), d);
+        }
+    }
+
+    // The face values of component d of the velocity normal to direction e are
+    // stored in q_half[d][e].  All of these values are indexed by the tile box
+    // grown by two in the upper direction.
+    int q_half_stride[NDIM];
+    int q_half_size = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        q_half_stride[d] = q_half_size;
+        q_half_size *= PPM_TILE_SIZE[d] + 2;
+    }
+    double* q_half[NDIM][NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (unsigned int e = 0; e < NDIM; ++e)
+        {
+            q_half[d][e] = tile_data + (d * NDIM + e) * q_half_size;
+        }
+    }
+
+    Index<NDIM> tile_lower, tile_upper;
+#if (NDIM == 3)
+    for (tile_lower(2) = patch_box.lower(2); tile_lower(2) <= patch_box.upper(2); tile_lower(2) += PPM_TILE_SIZE[2])
+#endif
+    {
+        for (tile_lower(1) = patch_box.lower(1); tile_lower(1) <= patch_box.upper(1);
+             tile_lower(1) += PPM_TILE_SIZE[1])
+        {
+            for (tile_lower(0) = patch_box.lower(0); tile_lower(0) <= patch_box.upper(0);
+                 tile_lower(0) += PPM_TILE_SIZE[0])
+            {
+                bool is_last_tile[NDIM];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    tile_upper(d) = std::min(tile_lower(d) + PPM_TILE_SIZE[d] - 1, patch_box.upper(d));
+                    is_last_tile[d] = tile_upper(d) == patch_box.upper(d);
+                }
+
+                // Extrapolate each component of the velocity to the faces of
+                // its control volumes.  The faces normal to the component are
+                // needed only for the control volumes in the tile, whereas the
+                // transverse faces are shared by the control volumes of two
+                // components.
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    for (unsigned int e = 0; e < NDIM; ++e)
+                    {
+                        Box<NDIM> face_box(tile_lower, tile_upper);
+                        face_box.upper(d) += 1;
+                        if (e == d)
+                        {
+                            if (is_last_tile[d]) face_box.upper(d) += 1;
+                        }
+                        else
+                        {
+                            face_box.upper(e) += 1;
+                        }
+                        const int n_faces = face_box.numberCells(e);
+                        Box<NDIM> line_box = face_box;
+                        line_box.upper(e) = line_box.lower(e);
+                        Index<NDIM> i = line_box.lower();
+#if (NDIM == 3)
+                        for (i(2) = line_box.lower(2); i(2) <= line_box.upper(2); ++i(2))
+#endif
+                        {
+                            for (i(1) = line_box.lower(1); i(1) <= line_box.upper(1); ++i(1))
+                            {
+                                for (i(0) = line_box.lower(0); i(0) <= line_box.upper(0); ++i(0))
+                                {
+                                    const double* const u_upper =
+                                        U[e] + array_offset(i, U_data.getArrayData(e).getBox().lower(), U_stride[e]);
+                                    xsppm7_extrapolate_line(
+                                        q_half[d][e] + array_offset(i, tile_lower, q_half_stride),
+                                        q_half_stride[e],
+                                        U[d] + array_offset(i, U_data.getArrayData(d).getBox().lower(), U_stride[d]),
+                                        U_stride[d][e],
+                                        u_upper - U_stride[e][d],
+                                        u_upper,
+                                        U_stride[e][e],
+                                        n_faces);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Difference the fluxes through the faces of the control
+                // volumes in the tile.
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    Box<NDIM> side_box(tile_lower, tile_upper);
+                    if (is_last_tile[d]) side_box.upper(d) += 1;
+                    Index<NDIM> i = side_box.lower();
+#if (NDIM == 3)
+                    for (i(2) = side_box.lower(2); i(2) <= side_box.upper(2); ++i(2))
+#endif
+                    {
+                        for (i(1) = side_box.lower(1); i(1) <= side_box.upper(1); ++i(1))
+                        {
+                            i(0) = side_box.lower(0);
+                            const int q_offset = array_offset(i, tile_lower, q_half_stride);
+                            double* const N_row =
+                                N[d] + array_offset(i, N_data.getArrayData(d).getBox().lower(), N_stride[d]);
+                            for (int k = 0; k < side_box.numberCells(0); ++k)
+                            {
+                                double N_val = 0.0;
+                                for (unsigned int e = 0; e < NDIM; ++e)
+                                {
+                                    const int lower = q_offset + k;
+                                    const int upper = lower + q_half_stride[e];
+                                    const double q_lower = q_half[d][e][lower];
+                                    const double q_upper = q_half[d][e][upper];
+                                    const double u_lower = q_half[e][d][lower];
+                                    const double u_upper = q_half[e][d][upper];
+                                    switch (difference_form)
+                                    {
+                                    case CONSERVATIVE:
+                                        N_val += (u_upper * q_upper - u_lower * q_lower) / dx[e];
+                                        break;
+                                    case ADVECTIVE:
+                                        N_val += 0.5 * (u_upper + u_lower) * ((q_upper - q_lower) / dx[e]);
+                                        break;
+                                    case SKEW_SYMMETRIC:
+                                        N_val += 0.5 * (0.5 * (u_upper + u_lower) * ((q_upper - q_lower) / dx[e]) +
+                                                        (u_upper * q_upper - u_lower * q_lower) / dx[e]);
+                                        break;
+                                    default:
+                                        TBOX_ERROR("apply_fused_ppm_convective_operator():\n"
+                                                   << "  unsupported differencing form: "
+                                                   << enum_to_string<ConvectiveDifferencingType>(difference_form)
+                                                   << " \n"
+                                                   << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
+                                    }
+                                }
+                                N_row[k * N_stride[d][0]] = N_val;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // apply_fused_ppm_convective_operator
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -478,7 +887,8 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(
       d_coarsest_ln(-1),
       d_finest_ln(-1),
       d_U_var(NULL),
-      d_U_scratch_idx(-1)
+      d_U_scratch_idx(-1),
+      d_use_fused_ppm_kernel(true)
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -492,6 +902,8 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("use_fused_ppm_kernel"))
+            d_use_fused_ppm_kernel = input_db->getBool("use_fused_ppm_kernel");
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -542,11 +954,15 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated by initializeOperatorState().  Reallocate
+    // any data freed by other operators that share the scratch variables.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
     }
 
     // Fill ghost cell values for all components.
@@ -572,9 +988,11 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
+            d_workspace.reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -586,15 +1004,22 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
+            if (d_use_fused_ppm_kernel)
+            {
+                double* const tile_data = &d_tile_data[ParallelPatchFor::getThreadNumber() * PPM_TILE_DATA_SIZE];
+                apply_fused_ppm_convective_operator(*N_data, *U_data, patch_box, dx, d_difference_form, tile_data);
+                continue;
+            }
+
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_adv_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_half_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
+                U_half_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -609,18 +1034,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[0].upper(0),
                                           side_boxes[0].lower(1),
                                           side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1));
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -641,51 +1066,51 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[0].upper(1),
                                           side_boxes[0].lower(2),
                                           side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getGhostCellWidth()(2),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
+                                          U_adv_data[0].getPointer(2),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
                                           side_boxes[1].lower(2),
                                           side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getGhostCellWidth()(2),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1),
+                                          U_adv_data[1].getPointer(2),
                                           side_boxes[2].lower(0),
                                           side_boxes[2].upper(0),
                                           side_boxes[2].lower(1),
                                           side_boxes[2].upper(1),
                                           side_boxes[2].lower(2),
                                           side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+                                          U_adv_data[2].getGhostCellWidth()(0),
+                                          U_adv_data[2].getGhostCellWidth()(1),
+                                          U_adv_data[2].getGhostCellWidth()(2),
+                                          U_adv_data[2].getPointer(0),
+                                          U_adv_data[2].getPointer(1),
+                                          U_adv_data[2].getPointer(2));
 #endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView dU_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_L_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_R_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_scratch1_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_scratch2_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
 #endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -694,18 +1119,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(0),
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
+                                       U_scratch1_data.getPointer(axis),
+                                       dU_data.getPointer(axis),
+                                       U_L_data.getPointer(axis),
+                                       U_R_data.getPointer(axis),
+                                       U_adv_data[axis].getGhostCellWidth()(0),
+                                       U_adv_data[axis].getGhostCellWidth()(1),
+                                       U_half_data[axis].getGhostCellWidth()(0),
+                                       U_half_data[axis].getGhostCellWidth()(1),
+                                       U_adv_data[axis].getPointer(0),
+                                       U_adv_data[axis].getPointer(1),
+                                       U_half_data[axis].getPointer(0),
+                                       U_half_data[axis].getPointer(1));
 #endif
 #if (NDIM == 3)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -718,23 +1143,23 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getGhostCellWidth()(2),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
+                                       U_scratch1_data.getPointer(axis),
+                                       U_scratch2_data.getPointer(axis),
+                                       dU_data.getPointer(axis),
+                                       U_L_data.getPointer(axis),
+                                       U_R_data.getPointer(axis),
+                                       U_adv_data[axis].getGhostCellWidth()(0),
+                                       U_adv_data[axis].getGhostCellWidth()(1),
+                                       U_adv_data[axis].getGhostCellWidth()(2),
+                                       U_half_data[axis].getGhostCellWidth()(0),
+                                       U_half_data[axis].getGhostCellWidth()(1),
+                                       U_half_data[axis].getGhostCellWidth()(2),
+                                       U_adv_data[axis].getPointer(0),
+                                       U_adv_data[axis].getPointer(1),
+                                       U_adv_data[axis].getPointer(2),
+                                       U_half_data[axis].getPointer(0),
+                                       U_half_data[axis].getPointer(1),
+                                       U_half_data[axis].getPointer(2));
 #endif
             }
 #if (NDIM == 2)
@@ -742,26 +1167,26 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                                 side_boxes[0].upper(0),
                                                 side_boxes[0].lower(1),
                                                 side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
+                                                U_adv_data[0].getGhostCellWidth()(0),
+                                                U_adv_data[0].getGhostCellWidth()(1),
+                                                U_adv_data[0].getPointer(0),
+                                                U_adv_data[0].getPointer(1),
+                                                U_half_data[0].getGhostCellWidth()(0),
+                                                U_half_data[0].getGhostCellWidth()(1),
+                                                U_half_data[0].getPointer(0),
+                                                U_half_data[0].getPointer(1),
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
+                                                U_adv_data[1].getGhostCellWidth()(0),
+                                                U_adv_data[1].getGhostCellWidth()(1),
+                                                U_adv_data[1].getPointer(0),
+                                                U_adv_data[1].getPointer(1),
+                                                U_half_data[1].getGhostCellWidth()(0),
+                                                U_half_data[1].getGhostCellWidth()(1),
+                                                U_half_data[1].getPointer(0),
+                                                U_half_data[1].getPointer(1));
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
@@ -770,54 +1195,54 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                                 side_boxes[0].upper(1),
                                                 side_boxes[0].lower(2),
                                                 side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
+                                                U_adv_data[0].getGhostCellWidth()(0),
+                                                U_adv_data[0].getGhostCellWidth()(1),
+                                                U_adv_data[0].getGhostCellWidth()(2),
+                                                U_adv_data[0].getPointer(0),
+                                                U_adv_data[0].getPointer(1),
+                                                U_adv_data[0].getPointer(2),
+                                                U_half_data[0].getGhostCellWidth()(0),
+                                                U_half_data[0].getGhostCellWidth()(1),
+                                                U_half_data[0].getGhostCellWidth()(2),
+                                                U_half_data[0].getPointer(0),
+                                                U_half_data[0].getPointer(1),
+                                                U_half_data[0].getPointer(2),
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
                                                 side_boxes[1].lower(2),
                                                 side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
+                                                U_adv_data[1].getGhostCellWidth()(0),
+                                                U_adv_data[1].getGhostCellWidth()(1),
+                                                U_adv_data[1].getGhostCellWidth()(2),
+                                                U_adv_data[1].getPointer(0),
+                                                U_adv_data[1].getPointer(1),
+                                                U_adv_data[1].getPointer(2),
+                                                U_half_data[1].getGhostCellWidth()(0),
+                                                U_half_data[1].getGhostCellWidth()(1),
+                                                U_half_data[1].getGhostCellWidth()(2),
+                                                U_half_data[1].getPointer(0),
+                                                U_half_data[1].getPointer(1),
+                                                U_half_data[1].getPointer(2),
                                                 side_boxes[2].lower(0),
                                                 side_boxes[2].upper(0),
                                                 side_boxes[2].lower(1),
                                                 side_boxes[2].upper(1),
                                                 side_boxes[2].lower(2),
                                                 side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
+                                                U_adv_data[2].getGhostCellWidth()(0),
+                                                U_adv_data[2].getGhostCellWidth()(1),
+                                                U_adv_data[2].getGhostCellWidth()(2),
+                                                U_adv_data[2].getPointer(0),
+                                                U_adv_data[2].getPointer(1),
+                                                U_adv_data[2].getPointer(2),
+                                                U_half_data[2].getGhostCellWidth()(0),
+                                                U_half_data[2].getGhostCellWidth()(1),
+                                                U_half_data[2].getGhostCellWidth()(2),
+                                                U_half_data[2].getPointer(0),
+                                                U_half_data[2].getPointer(1),
+                                                U_half_data[2].getPointer(2));
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
@@ -830,14 +1255,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[axis].upper(0),
                                           side_boxes[axis].lower(1),
                                           side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getPointer(axis));
@@ -850,18 +1275,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[axis].upper(1),
                                           side_boxes[axis].lower(2),
                                           side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getGhostCellWidth()(2),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(2),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_adv_data[axis].getPointer(2),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(2),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getGhostCellWidth()(2),
@@ -875,14 +1300,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                          side_boxes[axis].upper(0),
                                          side_boxes[axis].lower(1),
                                          side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getPointer(axis));
@@ -895,18 +1320,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                          side_boxes[axis].upper(1),
                                          side_boxes[axis].lower(2),
                                          side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getGhostCellWidth()(2),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(2),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_adv_data[axis].getPointer(2),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(2),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getGhostCellWidth()(2),
@@ -920,14 +1345,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                            side_boxes[axis].upper(0),
                                            side_boxes[axis].lower(1),
                                            side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getPointer(axis));
@@ -940,18 +1365,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                            side_boxes[axis].upper(1),
                                            side_boxes[axis].lower(2),
                                            side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getGhostCellWidth()(2),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(2),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_adv_data[axis].getPointer(2),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(2),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getGhostCellWidth()(2),
@@ -969,13 +1394,6 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1020,6 +1438,45 @@ INSStaggeredPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.  The data are retained until the operator state
+    // is deallocated, i.e., until the hierarchy configuration changes.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
+    }
+
+    // Size the tile buffers used by the fused kernel, one per thread, or the
+    // patch workspace for the largest local patch.
+    if (d_use_fused_ppm_kernel)
+    {
+        d_tile_data.resize(ParallelPatchFor::getMaxNumberOfThreads() * PPM_TILE_DATA_SIZE);
+    }
+    else
+    {
+        size_t workspace_size = 0;
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+                size_t patch_workspace_size =
+                    (NDIM == 2 ? 4 : 5) * PatchDataWorkspace::getDataSize(patch_box, 1, IntVector<NDIM>(GADVECTG));
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    patch_workspace_size +=
+                        2 * PatchDataWorkspace::getDataSize(SideGeometry<NDIM>::toSideBox(patch_box, axis), 1, 1);
+                }
+                workspace_size = std::max(workspace_size, patch_workspace_size);
+            }
+        }
+        d_workspace.reserve(workspace_size);
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1037,6 +1494,17 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx))
+        {
+            level->deallocatePatchData(d_U_scratch_idx);
+        }
+    }
+    d_workspace.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <cmath>
 #include <ostream>
 #include <string>
@@ -42,7 +43,6 @@
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "GridGeometry.h"
@@ -69,6 +69,8 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -471,6 +473,21 @@ smooth_kernel(const double r)
     return std::abs(r) < 1.0 ? 0.5 * (cos(M_PI * r) + 1.0) : 0.0;
 } // smooth_kernel
 
+// Return the offset of the value at the specified index in the specified
+// component of side-centered data with the specified box and ghost cell width.
+inline size_t
+side_data_offset(const Index<NDIM>& i, const unsigned int axis, const Box<NDIM>& box, const IntVector<NDIM>& ghosts)
+{
+    const Box<NDIM> data_box = SideGeometry<NDIM>::toSideBox(Box<NDIM>::grow(box, ghosts), axis);
+    size_t offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += stride * static_cast<size_t>(i(d) - data_box.lower(d));
+        stride *= static_cast<size_t>(data_box.numberCells(d));
+    }
+    return offset;
+} // side_data_offset
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_apply;
@@ -572,11 +589,15 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated by initializeOperatorState().  Reallocate
+    // any data freed by other operators that share the scratch variables.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
     }
 
     // Fill ghost cell values for all components.
@@ -605,9 +626,11 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& ratio = level->getRatio();
         const Box<NDIM> domain_box = Box<NDIM>::refine(grid_geometry->getPhysicalDomain()[0], ratio);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
+            d_workspace.reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -619,21 +642,21 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView N_upwind_data =
+                d_workspace.getSideData(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_upwind_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_adv_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_half_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_half_upwind_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
+                U_half_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
+                U_half_upwind_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
             }
 
 // Interpolate the staggered-grid velocity field onto the faces of
@@ -651,18 +674,18 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[0].upper(0),
                                           side_boxes[0].lower(1),
                                           side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1));
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -683,36 +706,36 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[0].upper(1),
                                           side_boxes[0].lower(2),
                                           side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getGhostCellWidth()(2),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
+                                          U_adv_data[0].getPointer(2),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
                                           side_boxes[1].lower(2),
                                           side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getGhostCellWidth()(2),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1),
+                                          U_adv_data[1].getPointer(2),
                                           side_boxes[2].lower(0),
                                           side_boxes[2].upper(0),
                                           side_boxes[2].lower(1),
                                           side_boxes[2].upper(1),
                                           side_boxes[2].lower(2),
                                           side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+                                          U_adv_data[2].getGhostCellWidth()(0),
+                                          U_adv_data[2].getGhostCellWidth()(1),
+                                          U_adv_data[2].getGhostCellWidth()(2),
+                                          U_adv_data[2].getPointer(0),
+                                          U_adv_data[2].getPointer(1),
+                                          U_adv_data[2].getPointer(2));
 #endif
 
             // Compute the first-order upwind discretization.
@@ -745,17 +768,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                               side_boxes[axis].upper(0),
                                               side_boxes[axis].lower(1),
                                               side_boxes[axis].upper(1),
-                                              U_adv_data[axis]->getGhostCellWidth()(0),
-                                              U_adv_data[axis]->getGhostCellWidth()(1),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                              U_adv_data[axis]->getPointer(0),
-                                              U_adv_data[axis]->getPointer(1),
-                                              U_half_upwind_data[axis]->getPointer(0),
-                                              U_half_upwind_data[axis]->getPointer(1),
-                                              N_upwind_data->getGhostCellWidth()(0),
-                                              N_upwind_data->getGhostCellWidth()(1),
-                                              N_upwind_data->getPointer(axis));
+                                              U_adv_data[axis].getGhostCellWidth()(0),
+                                              U_adv_data[axis].getGhostCellWidth()(1),
+                                              U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                              U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                              U_adv_data[axis].getPointer(0),
+                                              U_adv_data[axis].getPointer(1),
+                                              U_half_upwind_data[axis].getPointer(0),
+                                              U_half_upwind_data[axis].getPointer(1),
+                                              N_upwind_data.getGhostCellWidth()(0),
+                                              N_upwind_data.getGhostCellWidth()(1),
+                                              N_upwind_data.getPointer(axis));
 #endif
 #if (NDIM == 3)
                         CONVECT_DERIVATIVE_FC(dx,
@@ -765,22 +788,22 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                               side_boxes[axis].upper(1),
                                               side_boxes[axis].lower(2),
                                               side_boxes[axis].upper(2),
-                                              U_adv_data[axis]->getGhostCellWidth()(0),
-                                              U_adv_data[axis]->getGhostCellWidth()(1),
-                                              U_adv_data[axis]->getGhostCellWidth()(2),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                              U_adv_data[axis]->getPointer(0),
-                                              U_adv_data[axis]->getPointer(1),
-                                              U_adv_data[axis]->getPointer(2),
-                                              U_half_upwind_data[axis]->getPointer(0),
-                                              U_half_upwind_data[axis]->getPointer(1),
-                                              U_half_upwind_data[axis]->getPointer(2),
-                                              N_upwind_data->getGhostCellWidth()(0),
-                                              N_upwind_data->getGhostCellWidth()(1),
-                                              N_upwind_data->getGhostCellWidth()(2),
-                                              N_upwind_data->getPointer(axis));
+                                              U_adv_data[axis].getGhostCellWidth()(0),
+                                              U_adv_data[axis].getGhostCellWidth()(1),
+                                              U_adv_data[axis].getGhostCellWidth()(2),
+                                              U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                              U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                              U_half_upwind_data[axis].getGhostCellWidth()(2),
+                                              U_adv_data[axis].getPointer(0),
+                                              U_adv_data[axis].getPointer(1),
+                                              U_adv_data[axis].getPointer(2),
+                                              U_half_upwind_data[axis].getPointer(0),
+                                              U_half_upwind_data[axis].getPointer(1),
+                                              U_half_upwind_data[axis].getPointer(2),
+                                              N_upwind_data.getGhostCellWidth()(0),
+                                              N_upwind_data.getGhostCellWidth()(1),
+                                              N_upwind_data.getGhostCellWidth()(2),
+                                              N_upwind_data.getPointer(axis));
 #endif
                         break;
                     case ADVECTIVE:
@@ -790,17 +813,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                              side_boxes[axis].upper(0),
                                              side_boxes[axis].lower(1),
                                              side_boxes[axis].upper(1),
-                                             U_adv_data[axis]->getGhostCellWidth()(0),
-                                             U_adv_data[axis]->getGhostCellWidth()(1),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_half_upwind_data[axis]->getPointer(0),
-                                             U_half_upwind_data[axis]->getPointer(1),
-                                             N_upwind_data->getGhostCellWidth()(0),
-                                             N_upwind_data->getGhostCellWidth()(1),
-                                             N_upwind_data->getPointer(axis));
+                                             U_adv_data[axis].getGhostCellWidth()(0),
+                                             U_adv_data[axis].getGhostCellWidth()(1),
+                                             U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                             U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                             U_adv_data[axis].getPointer(0),
+                                             U_adv_data[axis].getPointer(1),
+                                             U_half_upwind_data[axis].getPointer(0),
+                                             U_half_upwind_data[axis].getPointer(1),
+                                             N_upwind_data.getGhostCellWidth()(0),
+                                             N_upwind_data.getGhostCellWidth()(1),
+                                             N_upwind_data.getPointer(axis));
 #endif
 #if (NDIM == 3)
                         ADVECT_DERIVATIVE_FC(dx,
@@ -810,22 +833,22 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                              side_boxes[axis].upper(1),
                                              side_boxes[axis].lower(2),
                                              side_boxes[axis].upper(2),
-                                             U_adv_data[axis]->getGhostCellWidth()(0),
-                                             U_adv_data[axis]->getGhostCellWidth()(1),
-                                             U_adv_data[axis]->getGhostCellWidth()(2),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_adv_data[axis]->getPointer(2),
-                                             U_half_upwind_data[axis]->getPointer(0),
-                                             U_half_upwind_data[axis]->getPointer(1),
-                                             U_half_upwind_data[axis]->getPointer(2),
-                                             N_upwind_data->getGhostCellWidth()(0),
-                                             N_upwind_data->getGhostCellWidth()(1),
-                                             N_upwind_data->getGhostCellWidth()(2),
-                                             N_upwind_data->getPointer(axis));
+                                             U_adv_data[axis].getGhostCellWidth()(0),
+                                             U_adv_data[axis].getGhostCellWidth()(1),
+                                             U_adv_data[axis].getGhostCellWidth()(2),
+                                             U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                             U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                             U_half_upwind_data[axis].getGhostCellWidth()(2),
+                                             U_adv_data[axis].getPointer(0),
+                                             U_adv_data[axis].getPointer(1),
+                                             U_adv_data[axis].getPointer(2),
+                                             U_half_upwind_data[axis].getPointer(0),
+                                             U_half_upwind_data[axis].getPointer(1),
+                                             U_half_upwind_data[axis].getPointer(2),
+                                             N_upwind_data.getGhostCellWidth()(0),
+                                             N_upwind_data.getGhostCellWidth()(1),
+                                             N_upwind_data.getGhostCellWidth()(2),
+                                             N_upwind_data.getPointer(axis));
 #endif
                         break;
                     case SKEW_SYMMETRIC:
@@ -835,17 +858,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                                side_boxes[axis].upper(0),
                                                side_boxes[axis].lower(1),
                                                side_boxes[axis].upper(1),
-                                               U_adv_data[axis]->getGhostCellWidth()(0),
-                                               U_adv_data[axis]->getGhostCellWidth()(1),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                               U_adv_data[axis]->getPointer(0),
-                                               U_adv_data[axis]->getPointer(1),
-                                               U_half_upwind_data[axis]->getPointer(0),
-                                               U_half_upwind_data[axis]->getPointer(1),
-                                               N_upwind_data->getGhostCellWidth()(0),
-                                               N_upwind_data->getGhostCellWidth()(1),
-                                               N_upwind_data->getPointer(axis));
+                                               U_adv_data[axis].getGhostCellWidth()(0),
+                                               U_adv_data[axis].getGhostCellWidth()(1),
+                                               U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                               U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                               U_adv_data[axis].getPointer(0),
+                                               U_adv_data[axis].getPointer(1),
+                                               U_half_upwind_data[axis].getPointer(0),
+                                               U_half_upwind_data[axis].getPointer(1),
+                                               N_upwind_data.getGhostCellWidth()(0),
+                                               N_upwind_data.getGhostCellWidth()(1),
+                                               N_upwind_data.getPointer(axis));
 #endif
 #if (NDIM == 3)
                         SKEW_SYM_DERIVATIVE_FC(dx,
@@ -855,22 +878,22 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                                side_boxes[axis].upper(1),
                                                side_boxes[axis].lower(2),
                                                side_boxes[axis].upper(2),
-                                               U_adv_data[axis]->getGhostCellWidth()(0),
-                                               U_adv_data[axis]->getGhostCellWidth()(1),
-                                               U_adv_data[axis]->getGhostCellWidth()(2),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                               U_adv_data[axis]->getPointer(0),
-                                               U_adv_data[axis]->getPointer(1),
-                                               U_adv_data[axis]->getPointer(2),
-                                               U_half_upwind_data[axis]->getPointer(0),
-                                               U_half_upwind_data[axis]->getPointer(1),
-                                               U_half_upwind_data[axis]->getPointer(2),
-                                               N_upwind_data->getGhostCellWidth()(0),
-                                               N_upwind_data->getGhostCellWidth()(1),
-                                               N_upwind_data->getGhostCellWidth()(2),
-                                               N_upwind_data->getPointer(axis));
+                                               U_adv_data[axis].getGhostCellWidth()(0),
+                                               U_adv_data[axis].getGhostCellWidth()(1),
+                                               U_adv_data[axis].getGhostCellWidth()(2),
+                                               U_half_upwind_data[axis].getGhostCellWidth()(0),
+                                               U_half_upwind_data[axis].getGhostCellWidth()(1),
+                                               U_half_upwind_data[axis].getGhostCellWidth()(2),
+                                               U_adv_data[axis].getPointer(0),
+                                               U_adv_data[axis].getPointer(1),
+                                               U_adv_data[axis].getPointer(2),
+                                               U_half_upwind_data[axis].getPointer(0),
+                                               U_half_upwind_data[axis].getPointer(1),
+                                               U_half_upwind_data[axis].getPointer(2),
+                                               N_upwind_data.getGhostCellWidth()(0),
+                                               N_upwind_data.getGhostCellWidth()(1),
+                                               N_upwind_data.getGhostCellWidth()(2),
+                                               N_upwind_data.getPointer(axis));
 #endif
                         break;
                     default:
@@ -887,20 +910,20 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
 
             // Compute the xsPPM7 discretization.
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView dU_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_L_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_R_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_scratch1_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            const PatchDataWorkspace::DataView U_scratch2_data =
+                d_workspace.getSideData(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
 #endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -909,18 +932,18 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                        U_data->getGhostCellWidth()(0),
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
+                                       U_scratch1_data.getPointer(axis),
+                                       dU_data.getPointer(axis),
+                                       U_L_data.getPointer(axis),
+                                       U_R_data.getPointer(axis),
+                                       U_adv_data[axis].getGhostCellWidth()(0),
+                                       U_adv_data[axis].getGhostCellWidth()(1),
+                                       U_half_data[axis].getGhostCellWidth()(0),
+                                       U_half_data[axis].getGhostCellWidth()(1),
+                                       U_adv_data[axis].getPointer(0),
+                                       U_adv_data[axis].getPointer(1),
+                                       U_half_data[axis].getPointer(0),
+                                       U_half_data[axis].getPointer(1));
 #endif
 #if (NDIM == 3)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -933,23 +956,23 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getGhostCellWidth()(2),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
+                                       U_scratch1_data.getPointer(axis),
+                                       U_scratch2_data.getPointer(axis),
+                                       dU_data.getPointer(axis),
+                                       U_L_data.getPointer(axis),
+                                       U_R_data.getPointer(axis),
+                                       U_adv_data[axis].getGhostCellWidth()(0),
+                                       U_adv_data[axis].getGhostCellWidth()(1),
+                                       U_adv_data[axis].getGhostCellWidth()(2),
+                                       U_half_data[axis].getGhostCellWidth()(0),
+                                       U_half_data[axis].getGhostCellWidth()(1),
+                                       U_half_data[axis].getGhostCellWidth()(2),
+                                       U_adv_data[axis].getPointer(0),
+                                       U_adv_data[axis].getPointer(1),
+                                       U_adv_data[axis].getPointer(2),
+                                       U_half_data[axis].getPointer(0),
+                                       U_half_data[axis].getPointer(1),
+                                       U_half_data[axis].getPointer(2));
 #endif
             }
 #if (NDIM == 2)
@@ -957,26 +980,26 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                                 side_boxes[0].upper(0),
                                                 side_boxes[0].lower(1),
                                                 side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
+                                                U_adv_data[0].getGhostCellWidth()(0),
+                                                U_adv_data[0].getGhostCellWidth()(1),
+                                                U_adv_data[0].getPointer(0),
+                                                U_adv_data[0].getPointer(1),
+                                                U_half_data[0].getGhostCellWidth()(0),
+                                                U_half_data[0].getGhostCellWidth()(1),
+                                                U_half_data[0].getPointer(0),
+                                                U_half_data[0].getPointer(1),
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
+                                                U_adv_data[1].getGhostCellWidth()(0),
+                                                U_adv_data[1].getGhostCellWidth()(1),
+                                                U_adv_data[1].getPointer(0),
+                                                U_adv_data[1].getPointer(1),
+                                                U_half_data[1].getGhostCellWidth()(0),
+                                                U_half_data[1].getGhostCellWidth()(1),
+                                                U_half_data[1].getPointer(0),
+                                                U_half_data[1].getPointer(1));
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
@@ -985,54 +1008,54 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                                 side_boxes[0].upper(1),
                                                 side_boxes[0].lower(2),
                                                 side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
+                                                U_adv_data[0].getGhostCellWidth()(0),
+                                                U_adv_data[0].getGhostCellWidth()(1),
+                                                U_adv_data[0].getGhostCellWidth()(2),
+                                                U_adv_data[0].getPointer(0),
+                                                U_adv_data[0].getPointer(1),
+                                                U_adv_data[0].getPointer(2),
+                                                U_half_data[0].getGhostCellWidth()(0),
+                                                U_half_data[0].getGhostCellWidth()(1),
+                                                U_half_data[0].getGhostCellWidth()(2),
+                                                U_half_data[0].getPointer(0),
+                                                U_half_data[0].getPointer(1),
+                                                U_half_data[0].getPointer(2),
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
                                                 side_boxes[1].lower(2),
                                                 side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
+                                                U_adv_data[1].getGhostCellWidth()(0),
+                                                U_adv_data[1].getGhostCellWidth()(1),
+                                                U_adv_data[1].getGhostCellWidth()(2),
+                                                U_adv_data[1].getPointer(0),
+                                                U_adv_data[1].getPointer(1),
+                                                U_adv_data[1].getPointer(2),
+                                                U_half_data[1].getGhostCellWidth()(0),
+                                                U_half_data[1].getGhostCellWidth()(1),
+                                                U_half_data[1].getGhostCellWidth()(2),
+                                                U_half_data[1].getPointer(0),
+                                                U_half_data[1].getPointer(1),
+                                                U_half_data[1].getPointer(2),
                                                 side_boxes[2].lower(0),
                                                 side_boxes[2].upper(0),
                                                 side_boxes[2].lower(1),
                                                 side_boxes[2].upper(1),
                                                 side_boxes[2].lower(2),
                                                 side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
+                                                U_adv_data[2].getGhostCellWidth()(0),
+                                                U_adv_data[2].getGhostCellWidth()(1),
+                                                U_adv_data[2].getGhostCellWidth()(2),
+                                                U_adv_data[2].getPointer(0),
+                                                U_adv_data[2].getPointer(1),
+                                                U_adv_data[2].getPointer(2),
+                                                U_half_data[2].getGhostCellWidth()(0),
+                                                U_half_data[2].getGhostCellWidth()(1),
+                                                U_half_data[2].getGhostCellWidth()(2),
+                                                U_half_data[2].getPointer(0),
+                                                U_half_data[2].getPointer(1),
+                                                U_half_data[2].getPointer(2));
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
@@ -1045,14 +1068,14 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[axis].upper(0),
                                           side_boxes[axis].lower(1),
                                           side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getPointer(axis));
@@ -1065,18 +1088,18 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[axis].upper(1),
                                           side_boxes[axis].lower(2),
                                           side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getGhostCellWidth()(2),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(2),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_adv_data[axis].getPointer(2),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(2),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getGhostCellWidth()(2),
@@ -1090,14 +1113,14 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                          side_boxes[axis].upper(0),
                                          side_boxes[axis].lower(1),
                                          side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getPointer(axis));
@@ -1110,18 +1133,18 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                          side_boxes[axis].upper(1),
                                          side_boxes[axis].lower(2),
                                          side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getGhostCellWidth()(2),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(2),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_adv_data[axis].getPointer(2),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(2),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getGhostCellWidth()(2),
@@ -1135,14 +1158,14 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                            side_boxes[axis].upper(0),
                                            side_boxes[axis].lower(1),
                                            side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getPointer(axis));
@@ -1155,18 +1178,18 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                            side_boxes[axis].upper(1),
                                            side_boxes[axis].lower(2),
                                            side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getGhostCellWidth()(2),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(2),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_adv_data[axis].getPointer(2),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(2),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getGhostCellWidth()(2),
@@ -1188,9 +1211,15 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             // physical boundaries.
             if (patch_geom->getTouchesRegularBoundary())
             {
-                Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
-                N_PPM_data->copy(*N_data);
+                const PatchDataWorkspace::DataView N_PPM_data =
+                    d_workspace.getSideData(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const ArrayData<NDIM, double>& N_array_data = N_data->getArrayData(axis);
+                    std::copy(N_array_data.getPointer(),
+                              N_array_data.getPointer() + N_array_data.getDepth() * N_array_data.getBox().size(),
+                              N_PPM_data.getPointer(axis));
+                }
                 for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
                 {
                     const unsigned int axis = location_index / 2;
@@ -1219,7 +1248,11 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                     x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
                                 const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
                                 const double fac = smooth_kernel((x - x_bdry) / width);
-                                (*N_data)(i_s) = fac * (*N_upwind_data)(i_s) + (1.0 - fac) * (*N_PPM_data)(i_s);
+                                const size_t idx =
+                                    side_data_offset(i, d, N_data->getBox(), N_data->getGhostCellWidth());
+                                const double N_upwind = N_upwind_data.getPointer(d)[idx];
+                                const double N_PPM = N_PPM_data.getPointer(d)[idx];
+                                (*N_data)(i_s) = fac * N_upwind + (1.0 - fac) * N_PPM;
                             }
                         }
                     }
@@ -1228,13 +1261,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1255,8 +1281,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     TBOX_ASSERT(d_hierarchy == out.getPatchHierarchy());
     TBOX_ASSERT(d_coarsest_ln == out.getCoarsestLevelNumber());
     TBOX_ASSERT(d_finest_ln == out.getFinestLevelNumber());
-#else
-    NULL_USE(out);
 #endif
 
     // Setup the interpolation transaction information.
@@ -1279,6 +1303,40 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.  The data are retained until the operator state
+    // is deallocated, i.e., until the hierarchy configuration changes.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
+    }
+
+    // Size the patch workspace for the largest local patch.
+    size_t workspace_size = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(out.getComponentDescriptorIndex(0));
+            size_t patch_workspace_size =
+                (NDIM == 2 ? 4 : 5) * PatchDataWorkspace::getDataSize(patch_box, 1, IntVector<NDIM>(GADVECTG)) +
+                2 * PatchDataWorkspace::getDataSize(patch_box, N_data->getDepth(), N_data->getGhostCellWidth());
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                patch_workspace_size +=
+                    3 * PatchDataWorkspace::getDataSize(SideGeometry<NDIM>::toSideBox(patch_box, axis), 1, 1);
+            }
+            workspace_size = std::max(workspace_size, patch_workspace_size);
+        }
+    }
+    d_workspace.reserve(workspace_size);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1296,6 +1354,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx))
+        {
+            level->deallocatePatchData(d_U_scratch_idx);
+        }
+    }
+    d_workspace.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -34,6 +34,7 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -164,14 +165,44 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     return extended_box;
 } // compute_tangential_extension
 
+// Identifiers for the data centerings of the random stresses used to key the
+// random number generator.
+static const uint32_t W_CC_TAG = 0;
+static const uint32_t W_NC_TAG = 1;
+static const uint32_t W_EC_TAG = 2; // edge axis d uses W_EC_TAG + d
+
+// Fill the box with standard normal random values.  The values are keyed on
+// the global index of each datum, so that they are independent of the patch
+// layout.
 void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const uint32_t key[2],
+         const int rand_val_num,
+         const int level_num,
+         const uint32_t data_tag)
 {
+    const int n = box.numberCells(0);
     for (int depth = 0; depth < data.getDepth(); ++depth)
     {
-        for (Box<NDIM>::Iterator i(box); i; i++)
+        const uint32_t stream_tag = static_cast<uint32_t>(depth) | (data_tag << 8) |
+                                    (static_cast<uint32_t>(level_num) << 12) |
+                                    (static_cast<uint32_t>(rand_val_num) << 20);
+        Index<NDIM> row = box.lower();
+#if (NDIM == 3)
+        for (row(2) = box.lower(2); row(2) <= box.upper(2); ++row(2))
+#endif
         {
-            RNG::genrandn(&data(i(), depth));
+            for (row(1) = box.lower(1); row(1) <= box.upper(1); ++row(1))
+            {
+#if (NDIM == 2)
+                const uint32_t stream[3] = { static_cast<uint32_t>(row(1)), 0, stream_tag };
+#endif
+#if (NDIM == 3)
+                const uint32_t stream[3] = { static_cast<uint32_t>(row(1)), static_cast<uint32_t>(row(2)), stream_tag };
+#endif
+                RNG::genrandn(&data(row, depth), n, row(0), stream, key);
+            }
         }
     }
     return;
@@ -191,6 +222,8 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
       d_weights(),
       d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0),
       d_traction_bc_scaling(0.0),
+      d_seed(0),
+      d_seed_is_set(false),
       d_context(NULL),
       d_W_cc_var(NULL),
       d_W_cc_idx(-1),
@@ -230,6 +263,11 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
             d_velocity_bc_scaling = input_db->getDouble("velocity_bc_scaling");
         if (input_db->keyExists("traction_bc_scaling"))
             d_traction_bc_scaling = input_db->getDouble("traction_bc_scaling");
+        if (input_db->keyExists("seed"))
+        {
+            d_seed = input_db->getInteger("seed");
+            d_seed_is_set = true;
+        }
     }
 
     // Setup variables and variable context objects.
@@ -305,6 +343,13 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            if (!d_seed_is_set)
+            {
+                d_seed = RNG::get_global_seed();
+                d_seed_is_set = true;
+            }
+            const uint32_t key[2] = { static_cast<uint32_t>(d_seed),
+                                      static_cast<uint32_t>(d_fluid_solver->getIntegratorStep()) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -314,16 +359,26 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox(), key, k, level_num, W_CC_TAG);
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        genrandn(W_nc_data->getArrayData(),
+                                 NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                 key,
+                                 k,
+                                 level_num,
+                                 W_NC_TAG);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            genrandn(W_ec_data->getArrayData(d),
+                                     EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                     key,
+                                     k,
+                                     level_num,
+                                     W_EC_TAG + d);
                         }
 #endif
                     }
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -40,7 +41,6 @@
 #include "ArrayData.h"
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "IBAMR_config.h"
@@ -65,6 +65,8 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ParallelPatchFor.h"
+#include "ibtk/PatchDataWorkspace.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -401,11 +403,15 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated by initializeOperatorState().  Reallocate
+    // any data freed by other operators that share the scratch variables.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
     }
 
     // Fill ghost cell values for all components.
@@ -431,9 +437,11 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        const ParallelPatchFor patch_for(level);
+        IBTK_PARALLEL_PATCH_FOR(k, patch_for)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > patch = patch_for.getPatch(k);
+            d_workspace.reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -447,13 +455,13 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
 
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_adv_data;
+            boost::array<PatchDataWorkspace::DataView, NDIM> U_half_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
+                U_half_data[axis] = d_workspace.getFaceData(side_boxes[axis], 1, ghosts);
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -468,18 +476,18 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                           side_boxes[0].upper(0),
                                           side_boxes[0].lower(1),
                                           side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1));
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -500,36 +508,36 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                           side_boxes[0].upper(1),
                                           side_boxes[0].lower(2),
                                           side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
+                                          U_adv_data[0].getGhostCellWidth()(0),
+                                          U_adv_data[0].getGhostCellWidth()(1),
+                                          U_adv_data[0].getGhostCellWidth()(2),
+                                          U_adv_data[0].getPointer(0),
+                                          U_adv_data[0].getPointer(1),
+                                          U_adv_data[0].getPointer(2),
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
                                           side_boxes[1].lower(2),
                                           side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
+                                          U_adv_data[1].getGhostCellWidth()(0),
+                                          U_adv_data[1].getGhostCellWidth()(1),
+                                          U_adv_data[1].getGhostCellWidth()(2),
+                                          U_adv_data[1].getPointer(0),
+                                          U_adv_data[1].getPointer(1),
+                                          U_adv_data[1].getPointer(2),
                                           side_boxes[2].lower(0),
                                           side_boxes[2].upper(0),
                                           side_boxes[2].lower(1),
                                           side_boxes[2].upper(1),
                                           side_boxes[2].lower(2),
                                           side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+                                          U_adv_data[2].getGhostCellWidth()(0),
+                                          U_adv_data[2].getGhostCellWidth()(1),
+                                          U_adv_data[2].getGhostCellWidth()(2),
+                                          U_adv_data[2].getPointer(0),
+                                          U_adv_data[2].getPointer(1),
+                                          U_adv_data[2].getPointer(2));
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
@@ -558,14 +566,14 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                           side_boxes[axis].upper(0),
                                           side_boxes[axis].lower(1),
                                           side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getPointer(axis));
@@ -578,18 +586,18 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                           side_boxes[axis].upper(1),
                                           side_boxes[axis].lower(2),
                                           side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
+                                          U_adv_data[axis].getGhostCellWidth()(0),
+                                          U_adv_data[axis].getGhostCellWidth()(1),
+                                          U_adv_data[axis].getGhostCellWidth()(2),
+                                          U_half_data[axis].getGhostCellWidth()(0),
+                                          U_half_data[axis].getGhostCellWidth()(1),
+                                          U_half_data[axis].getGhostCellWidth()(2),
+                                          U_adv_data[axis].getPointer(0),
+                                          U_adv_data[axis].getPointer(1),
+                                          U_adv_data[axis].getPointer(2),
+                                          U_half_data[axis].getPointer(0),
+                                          U_half_data[axis].getPointer(1),
+                                          U_half_data[axis].getPointer(2),
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getGhostCellWidth()(2),
@@ -603,14 +611,14 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                          side_boxes[axis].upper(0),
                                          side_boxes[axis].lower(1),
                                          side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getPointer(axis));
@@ -623,18 +631,18 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                          side_boxes[axis].upper(1),
                                          side_boxes[axis].lower(2),
                                          side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
+                                         U_adv_data[axis].getGhostCellWidth()(0),
+                                         U_adv_data[axis].getGhostCellWidth()(1),
+                                         U_adv_data[axis].getGhostCellWidth()(2),
+                                         U_half_data[axis].getGhostCellWidth()(0),
+                                         U_half_data[axis].getGhostCellWidth()(1),
+                                         U_half_data[axis].getGhostCellWidth()(2),
+                                         U_adv_data[axis].getPointer(0),
+                                         U_adv_data[axis].getPointer(1),
+                                         U_adv_data[axis].getPointer(2),
+                                         U_half_data[axis].getPointer(0),
+                                         U_half_data[axis].getPointer(1),
+                                         U_half_data[axis].getPointer(2),
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getGhostCellWidth()(2),
@@ -648,14 +656,14 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                            side_boxes[axis].upper(0),
                                            side_boxes[axis].lower(1),
                                            side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getPointer(axis));
@@ -668,18 +676,18 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
                                            side_boxes[axis].upper(1),
                                            side_boxes[axis].lower(2),
                                            side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
+                                           U_adv_data[axis].getGhostCellWidth()(0),
+                                           U_adv_data[axis].getGhostCellWidth()(1),
+                                           U_adv_data[axis].getGhostCellWidth()(2),
+                                           U_half_data[axis].getGhostCellWidth()(0),
+                                           U_half_data[axis].getGhostCellWidth()(1),
+                                           U_half_data[axis].getGhostCellWidth()(2),
+                                           U_adv_data[axis].getPointer(0),
+                                           U_adv_data[axis].getPointer(1),
+                                           U_adv_data[axis].getPointer(2),
+                                           U_half_data[axis].getPointer(0),
+                                           U_half_data[axis].getPointer(1),
+                                           U_half_data[axis].getPointer(2),
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getGhostCellWidth()(2),
@@ -697,13 +705,6 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -748,6 +749,36 @@ INSStaggeredUpwindConvectiveOperator::initializeOperatorState(const SAMRAIVector
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.  The data are retained until the operator state
+    // is deallocated, i.e., until the hierarchy configuration changes.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx))
+        {
+            level->allocatePatchData(d_U_scratch_idx);
+        }
+    }
+
+    // Size the patch workspace for the largest local patch.
+    size_t workspace_size = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            size_t patch_workspace_size = 0;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                patch_workspace_size +=
+                    2 * PatchDataWorkspace::getDataSize(SideGeometry<NDIM>::toSideBox(patch_box, axis), 1, 1);
+            }
+            workspace_size = std::max(workspace_size, patch_workspace_size);
+        }
+    }
+    d_workspace.reserve(workspace_size);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -765,6 +796,17 @@ INSStaggeredUpwindConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx))
+        {
+            level->deallocatePatchData(d_U_scratch_idx);
+        }
+    }
+    d_workspace.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
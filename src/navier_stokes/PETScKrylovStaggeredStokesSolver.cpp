@@ -32,9 +32,22 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "ibamr/KrylovLinearSolverStaggeredStokesSolverInterface.h"
 #include "ibamr/PETScKrylovStaggeredStokesSolver.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/LinearOperator.h"
+#include "ibtk/PETScKrylovLinearSolver.h"
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -47,20 +60,188 @@ namespace IBAMR
 PETScKrylovStaggeredStokesSolver::PETScKrylovStaggeredStokesSolver(const std::string& object_name,
                                                                    Pointer<Database> input_db,
                                                                    const std::string& default_options_prefix)
-    : PETScKrylovLinearSolver(object_name, input_db, default_options_prefix)
+    : PETScKrylovLinearSolver(object_name, input_db, default_options_prefix),
+      d_enable_krylov_recycling(false),
+      d_max_recycled_vecs(8),
+      d_recycled_U_vecs(),
+      d_recycled_C_vecs(),
+      d_recycling_x0_vec(),
+      d_recycling_r_vec(),
+      d_U_problem_coefs_constant(false),
+      d_U_problem_C(std::numeric_limits<double>::quiet_NaN()),
+      d_U_problem_D(std::numeric_limits<double>::quiet_NaN())
 {
-    // intentionally blank
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_krylov_recycling"))
+            d_enable_krylov_recycling = input_db->getBool("enable_krylov_recycling");
+        if (input_db->keyExists("max_recycled_vectors"))
+            d_max_recycled_vecs = input_db->getInteger("max_recycled_vectors");
+    }
+    if (d_max_recycled_vecs < 1) d_enable_krylov_recycling = false;
     return;
 } // PETScKrylovStaggeredStokesSolver()
 
 PETScKrylovStaggeredStokesSolver::~PETScKrylovStaggeredStokesSolver()
 {
-    // intentionally blank
+    clearRecycledSubspace();
     return;
 } // ~PETScKrylovStaggeredStokesSolver()
 
+void
+PETScKrylovStaggeredStokesSolver::setVelocityPoissonSpecifications(const PoissonSpecifications& U_problem_coefs)
+{
+    KrylovLinearSolverStaggeredStokesSolverInterface::setVelocityPoissonSpecifications(U_problem_coefs);
+
+    // The recycled subspace remains valid only as long as the operator is
+    // unchanged.  Variable coefficients are conservatively assumed to change.
+    const bool coefs_constant = U_problem_coefs.cIsConstant() && U_problem_coefs.dIsConstant();
+    const double C = coefs_constant ? U_problem_coefs.getCConstant() : std::numeric_limits<double>::quiet_NaN();
+    const double D = coefs_constant ? U_problem_coefs.getDConstant() : std::numeric_limits<double>::quiet_NaN();
+    if (!coefs_constant || !d_U_problem_coefs_constant || C != d_U_problem_C || D != d_U_problem_D)
+    {
+        clearRecycledSubspace();
+    }
+    d_U_problem_coefs_constant = coefs_constant;
+    d_U_problem_C = C;
+    d_U_problem_D = D;
+    return;
+} // setVelocityPoissonSpecifications
+
+bool
+PETScKrylovStaggeredStokesSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    // The recycled subspace is tied to the solver state, so it is only used
+    // when the solver has been explicitly initialized.
+    if (!d_enable_krylov_recycling || !d_is_initialized) return PETScKrylovLinearSolver::solveSystem(x, b);
+
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    Pointer<SAMRAIVectorReal<NDIM, double> > b_ptr(&b, false);
+    if (!d_recycling_x0_vec)
+    {
+        d_recycling_x0_vec = x.cloneVector(x.getName() + "::recycling_x0");
+        d_recycling_x0_vec->allocateVectorData();
+        d_recycling_r_vec = b.cloneVector(b.getName() + "::recycling_r");
+        d_recycling_r_vec->allocateVectorData();
+    }
+
+    // Project the initial residual onto the recycled subspace: with C = A U
+    // orthonormal, x0 := x0 + U C^T (b - A x0) minimizes the residual over
+    // x0 + span(U).
+    const bool initial_guess_nonzero = d_initial_guess_nonzero;
+    if (!initial_guess_nonzero) x.setToScalar(0.0);
+    if (!d_recycled_U_vecs.empty())
+    {
+        d_A->setHomogeneousBc(d_homogeneous_bc);
+        d_A->apply(x, *d_recycling_r_vec);
+        d_recycling_r_vec->subtract(b_ptr, d_recycling_r_vec);
+        for (unsigned int k = 0; k < d_recycled_U_vecs.size(); ++k)
+        {
+            const double alpha = d_recycled_C_vecs[k]->dot(d_recycling_r_vec);
+            x.axpy(alpha, d_recycled_U_vecs[k], x_ptr);
+        }
+    }
+    d_recycling_x0_vec->copyVector(x_ptr);
+
+    // Solve the system starting from the projected initial guess.
+    d_initial_guess_nonzero = true;
+    const bool converged = PETScKrylovLinearSolver::solveSystem(x, b);
+    d_initial_guess_nonzero = initial_guess_nonzero;
+
+    // Add the new correction to the recycled subspace.
+    updateRecycledSubspace(x);
+    return converged;
+} // solveSystem
+
+void
+PETScKrylovStaggeredStokesSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                        const SAMRAIVectorReal<NDIM, double>& b)
+{
+    clearRecycledSubspace();
+    PETScKrylovLinearSolver::initializeSolverState(x, b);
+    return;
+} // initializeSolverState
+
+void
+PETScKrylovStaggeredStokesSolver::deallocateSolverState()
+{
+    clearRecycledSubspace();
+    PETScKrylovLinearSolver::deallocateSolverState();
+    return;
+} // deallocateSolverState
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PETScKrylovStaggeredStokesSolver::updateRecycledSubspace(SAMRAIVectorReal<NDIM, double>& x)
+{
+    // Reuse the storage of the oldest vectors once the subspace is full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > u_vec, c_vec;
+    if (static_cast<int>(d_recycled_U_vecs.size()) < d_max_recycled_vecs)
+    {
+        u_vec = d_recycling_x0_vec->cloneVector(d_recycling_x0_vec->getName() + "::U");
+        u_vec->allocateVectorData();
+        c_vec = d_recycling_r_vec->cloneVector(d_recycling_r_vec->getName() + "::C");
+        c_vec->allocateVectorData();
+    }
+    else
+    {
+        u_vec = d_recycled_U_vecs.front();
+        c_vec = d_recycled_C_vecs.front();
+        d_recycled_U_vecs.erase(d_recycled_U_vecs.begin());
+        d_recycled_C_vecs.erase(d_recycled_C_vecs.begin());
+    }
+
+    // Compute the correction and its image under the homogeneous operator.
+    u_vec->subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false), d_recycling_x0_vec);
+    d_A->setHomogeneousBc(true);
+    d_A->apply(*u_vec, *c_vec);
+    d_A->setHomogeneousBc(d_homogeneous_bc);
+
+    // Orthonormalize the image against the existing recycled subspace, and
+    // keep the correction consistent with it.
+    const double c_norm_init = std::sqrt(c_vec->dot(c_vec));
+    for (unsigned int k = 0; k < d_recycled_C_vecs.size(); ++k)
+    {
+        const double h = d_recycled_C_vecs[k]->dot(c_vec);
+        c_vec->axpy(-h, d_recycled_C_vecs[k], c_vec);
+        u_vec->axpy(-h, d_recycled_U_vecs[k], u_vec);
+    }
+    const double c_norm = std::sqrt(c_vec->dot(c_vec));
+    if (c_norm_init <= std::numeric_limits<double>::epsilon() || c_norm <= 1.0e-8 * c_norm_init)
+    {
+        // The correction does not enlarge the subspace.
+        u_vec->freeVectorComponents();
+        c_vec->freeVectorComponents();
+        return;
+    }
+    c_vec->scale(1.0 / c_norm, c_vec);
+    u_vec->scale(1.0 / c_norm, u_vec);
+    d_recycled_U_vecs.push_back(u_vec);
+    d_recycled_C_vecs.push_back(c_vec);
+    if (d_enable_logging)
+        plog << d_object_name << "::solveSystem(): recycled subspace dimension = " << d_recycled_U_vecs.size()
+             << "\n";
+    return;
+} // updateRecycledSubspace
+
+void
+PETScKrylovStaggeredStokesSolver::clearRecycledSubspace()
+{
+    for (unsigned int k = 0; k < d_recycled_U_vecs.size(); ++k)
+    {
+        d_recycled_U_vecs[k]->freeVectorComponents();
+        d_recycled_C_vecs[k]->freeVectorComponents();
+    }
+    d_recycled_U_vecs.clear();
+    d_recycled_C_vecs.clear();
+    if (d_recycling_x0_vec) d_recycling_x0_vec->freeVectorComponents();
+    if (d_recycling_r_vec) d_recycling_r_vec->freeVectorComponents();
+    d_recycling_x0_vec.setNull();
+    d_recycling_r_vec.setNull();
+    return;
+} // clearRecycledSubspace
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -38,14 +38,24 @@
 #include <string>
 #include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideIndex.h"
 #include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "ibamr/StaggeredStokesOperator.h"
@@ -56,6 +66,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearOperator.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -92,6 +103,128 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Stride between consecutive indices along the specified axis in the array.
+inline int
+array_stride(const ArrayData<NDIM, double>& data, const int axis)
+{
+    const Box<NDIM>& data_box = data.getBox();
+    int stride = 1;
+    for (int d = 0; d < axis; ++d)
+    {
+        stride *= data_box.numberCells(d);
+    }
+    return stride;
+} // array_stride
+
+// Compute
+//
+//    A_U := (C*I+D*L)*U + Grad P
+//    A_P := -Div U
+//
+// in a single sweep over the rows of the patch.  Each row of cells supplies
+// the lower normal faces of its cells, so that all of the components of A_U
+// and A_P that share data are evaluated together while that data is in cache.
+void
+apply_fused_stokes_operator(SideData<NDIM, double>& A_U_data,
+                            CellData<NDIM, double>& A_P_data,
+                            const SideData<NDIM, double>& U_data,
+                            const CellData<NDIM, double>& P_data,
+                            const Box<NDIM>& patch_box,
+                            const double* const dx,
+                            const double C,
+                            const double D)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_data.getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(P_data.getGhostCellWidth().min() >= 1);
+#endif
+    double inv_dx[NDIM], inv_dx_sq[NDIM];
+    int U_stride[NDIM][NDIM], P_stride[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        inv_dx[d] = 1.0 / dx[d];
+        inv_dx_sq[d] = inv_dx[d] * inv_dx[d];
+        P_stride[d] = array_stride(P_data.getArrayData(), d);
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_stride[axis][d] = array_stride(U_data.getArrayData(axis), d);
+        }
+    }
+
+    const int ilower = patch_box.lower(0);
+    const int iupper = patch_box.upper(0);
+    Index<NDIM> row = patch_box.lower();
+#if (NDIM == 3)
+    for (row(2) = patch_box.lower(2); row(2) <= patch_box.upper(2) + 1; ++row(2))
+#endif
+    {
+        for (row(1) = patch_box.lower(1); row(1) <= patch_box.upper(1) + 1; ++row(1))
+        {
+            // Determine which of the side-centered components have faces in
+            // this row; the extra rows along each axis carry only the upper
+            // faces normal to that axis.
+            bool row_has_faces[NDIM];
+            bool row_has_cells = true;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                row_has_faces[axis] = true;
+                for (unsigned int d = 1; d < NDIM; ++d)
+                {
+                    if (row(d) > patch_box.upper(d) + (d == axis ? 1 : 0)) row_has_faces[axis] = false;
+                }
+            }
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                if (row(d) > patch_box.upper(d)) row_has_cells = false;
+            }
+
+            const double* const P = &P_data(CellIndex<NDIM>(row), 0);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                if (!row_has_faces[axis]) continue;
+                const SideIndex<NDIM> s_row(row, axis, SideIndex<NDIM>::Lower);
+                const double* const U = &U_data.getArrayData(axis)(s_row, 0);
+                double* const A_U = &A_U_data.getArrayData(axis)(s_row, 0);
+                const int* const s = U_stride[axis];
+                const int P_s = P_stride[axis];
+                const int iend = iupper - ilower + (axis == 0 ? 1 : 0);
+                for (int i = 0; i <= iend; ++i)
+                {
+                    double lap = 0.0;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        lap += (U[i + s[d]] - 2.0 * U[i] + U[i - s[d]]) * inv_dx_sq[d];
+                    }
+                    A_U[i] = D * lap + C * U[i] + (P[i] - P[i - P_s]) * inv_dx[axis];
+                }
+            }
+
+            if (!row_has_cells) continue;
+            double* const A_P = &A_P_data(CellIndex<NDIM>(row), 0);
+            const double* U_axis[NDIM];
+            int U_s[NDIM];
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                U_axis[axis] = &U_data.getArrayData(axis)(SideIndex<NDIM>(row, axis, SideIndex<NDIM>::Lower), 0);
+                U_s[axis] = U_stride[axis][axis];
+            }
+            for (int i = 0; i <= iupper - ilower; ++i)
+            {
+                double div = 0.0;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    div += (U_axis[axis][i + U_s[axis]] - U_axis[axis][i]) * inv_dx[axis];
+                }
+                A_P[i] = -div;
+            }
+        }
+    }
+    return;
+} // apply_fused_stokes_operator
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -112,7 +245,8 @@ StaggeredStokesOperator::StaggeredStokesOperator(const std::string& object_name,
       d_hier_bdry_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
       d_no_fill(Pointer<HierarchyGhostCellInterpolation>(NULL)),
       d_x(NULL),
-      d_b(NULL)
+      d_b(NULL),
+      d_use_fused_apply(true)
 {
     // Setup a default boundary condition object that specifies homogeneous
     // Dirichlet boundary conditions for the velocity and homogeneous Neumann
@@ -164,6 +298,13 @@ StaggeredStokesOperator::getVelocityPoissonSpecifications() const
     return d_U_problem_coefs;
 } // getVelocityPoissonSpecifications
 
+void
+StaggeredStokesOperator::setFusedApplyEnabled(const bool enabled)
+{
+    d_use_fused_apply = enabled;
+    return;
+} // setFusedApplyEnabled
+
 void
 StaggeredStokesOperator::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrategy<NDIM>*>& U_bc_coefs,
                                             RobinBcCoefStrategy<NDIM>* P_bc_coef)
@@ -255,32 +396,44 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
+    //
+    // When C and D are constant, all components are evaluated by a single
+    // fused patch kernel (unless it has been disabled).  Otherwise, we fall
+    // back on the individual differencing operators.
+    if (d_use_fused_apply && (d_U_problem_coefs.cIsZero() || d_U_problem_coefs.cIsConstant()) &&
+        d_U_problem_coefs.dIsConstant())
+    {
+        applyFused(x, y);
+    }
+    else
+    {
+        d_hier_math_ops->grad(A_U_idx,
+                              A_U_sc_var,
+                              /*cf_bdry_synch*/ false,
+                              1.0,
+                              P_idx,
+                              P_cc_var,
+                              d_no_fill,
+                              d_new_time);
+        d_hier_math_ops->laplace(A_U_idx,
+                                 A_U_sc_var,
+                                 d_U_problem_coefs,
+                                 U_scratch_idx,
+                                 U_sc_var,
+                                 d_no_fill,
+                                 d_new_time,
+                                 1.0,
+                                 A_U_idx,
+                                 A_U_sc_var);
+        d_hier_math_ops->div(A_P_idx,
+                             A_P_cc_var,
+                             -1.0,
                              U_scratch_idx,
                              U_sc_var,
                              d_no_fill,
                              d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+                             /*cf_bdry_synch*/ true);
+    }
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
     // Deallocate scratch data.
@@ -436,6 +589,68 @@ StaggeredStokesOperator::imposeSolBcs(SAMRAIVectorReal<NDIM, double>& u)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+StaggeredStokesOperator::applyFused(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& y)
+{
+    const int P_idx = x.getComponentDescriptorIndex(1);
+    const int A_U_idx = y.getComponentDescriptorIndex(0);
+    const int A_P_idx = y.getComponentDescriptorIndex(1);
+    const int U_scratch_idx = d_x->getComponentDescriptorIndex(0);
+    Pointer<SideVariable<NDIM, double> > U_sc_var = x.getComponentVariable(0);
+    Pointer<SideVariable<NDIM, double> > A_U_sc_var = y.getComponentVariable(0);
+
+    const double C = d_U_problem_coefs.cIsZero() ? 0.0 : d_U_problem_coefs.getCConstant();
+    const double D = d_U_problem_coefs.getDConstant();
+
+    // Evaluate the operator independently on each level.  As in the unfused
+    // evaluation, the momentum residual is computed from velocity values that
+    // have not yet been synchronized along the coarse-fine interface.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    const int coarsest_ln = y.getCoarsestLevelNumber();
+    const int finest_ln = y.getFinestLevelNumber();
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            Pointer<SideData<NDIM, double> > A_U_data = patch->getPatchData(A_U_idx);
+            Pointer<CellData<NDIM, double> > A_P_data = patch->getPatchData(A_P_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_scratch_idx);
+            Pointer<CellData<NDIM, double> > P_data = patch->getPatchData(P_idx);
+            apply_fused_stokes_operator(
+                *A_U_data, *A_P_data, *U_data, *P_data, patch->getBox(), pgeom->getDx(), C, D);
+        }
+    }
+
+    // Synchronize the momentum residual along the coarse-fine interface, as in
+    // HierarchyMathOps::laplace().
+    for (int ln = finest_ln; ln > coarsest_ln; --ln)
+    {
+        d_hier_math_ops->synchronizeCoarseFineInterface(A_U_idx, A_U_sc_var, ln);
+    }
+
+    // Synchronize the velocity along the coarse-fine interface and recompute
+    // the continuity residual on the coarser level, as in
+    // HierarchyMathOps::div().  Like the unfused evaluation, this modifies the
+    // scratch velocity on the coarse-fine interface.
+    PatchMathOps patch_math_ops;
+    for (int ln = finest_ln; ln > coarsest_ln; --ln)
+    {
+        d_hier_math_ops->synchronizeCoarseFineInterface(U_scratch_idx, U_sc_var, ln);
+        Pointer<PatchLevel<NDIM> > coarser_level = hierarchy->getPatchLevel(ln - 1);
+        for (PatchLevel<NDIM>::Iterator p(coarser_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = coarser_level->getPatch(p());
+            Pointer<CellData<NDIM, double> > A_P_data = patch->getPatchData(A_P_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_scratch_idx);
+            patch_math_ops.div(A_P_data, -1.0, U_data, 0.0, Pointer<CellData<NDIM, double> >(NULL), patch);
+        }
+    }
+    return;
+} // applyFused
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -3,6 +3,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <time.h>
+#include <algorithm>
 #include <iosfwd>
 #include <iostream>
 #include <map>
@@ -77,6 +78,8 @@ namespace IBAMR
 static unsigned long mt[N]; /* the array for the state vector  */
 static int mti = N + 1;     /* mti==N+1 means mt[N] is not initialized */
 
+static int global_seed_value = 0; /* the seed passed to parallel_seed() */
+
 void
 RNG::srandgen(unsigned long seed)
 {
@@ -262,6 +265,11 @@ RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // Record the global seed on all processes for use by the counter-based
+    // generator.
+    MPI_Bcast(&seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    global_seed_value = seed;
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -310,6 +318,123 @@ RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+int
+RNG::get_global_seed()
+{
+    return global_seed_value;
+} // get_global_seed
+
+/*
+** Philox-4x32-10 counter-based generator.
+**
+** REFERENCE
+** J.K. Salmon, M.A. Moraes, R.O. Dror, and D.E. Shaw,
+** "Parallel Random Numbers: As Easy as 1, 2, 3",
+** Proceedings of SC11, 2011.
+*/
+namespace
+{
+static const uint32_t PHILOX_M4x32_0 = 0xD2511F53;
+static const uint32_t PHILOX_M4x32_1 = 0xCD9E8D57;
+static const uint32_t PHILOX_W32_0 = 0x9E3779B9;
+static const uint32_t PHILOX_W32_1 = 0xBB67AE85;
+static const int PHILOX_ROUNDS = 10;
+
+inline void
+mulhilo32(const uint32_t a, const uint32_t b, uint32_t* hi, uint32_t* lo)
+{
+    const uint64_t product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+    *hi = static_cast<uint32_t>(product >> 32);
+    *lo = static_cast<uint32_t>(product);
+    return;
+} // mulhilo32
+
+// Map a 32-bit integer to a uniform value in (0,1].
+inline double
+u01(const uint32_t x)
+{
+    return (static_cast<double>(x) + 1.0) * 2.3283064365386963e-10;
+} // u01
+
+// Floor of i/4 for positive and negative integers.
+inline int
+floor_div4(const int i)
+{
+    return i >= 0 ? i / 4 : -((-i + 3) / 4);
+} // floor_div4
+}
+
+void
+RNG::philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t result[4])
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        uint32_t hi0, lo0, hi1, lo1;
+        mulhilo32(PHILOX_M4x32_0, c0, &hi0, &lo0);
+        mulhilo32(PHILOX_M4x32_1, c2, &hi1, &lo1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += PHILOX_W32_0;
+        k1 += PHILOX_W32_1;
+    }
+    result[0] = c0;
+    result[1] = c1;
+    result[2] = c2;
+    result[3] = c3;
+    return;
+} // philox4x32
+
+void
+RNG::genrandn(double* const values, const int n, const int i_lower, const uint32_t stream[3], const uint32_t key[2])
+{
+    static const double two_pi = 6.283185307179586;
+    static const int CHUNK_SIZE = 64;
+    if (n <= 0) return;
+
+    // Generate normal values four at a time, one Philox counter per group of
+    // four consecutive global indices.  The counters are evaluated for a chunk
+    // of groups before the Box-Muller transform is applied to the whole chunk,
+    // so that both loops have no loop-carried dependencies.  Partial groups at
+    // either end of the range are generated in full and only the requested
+    // entries are kept.
+    const int i_upper = i_lower + n - 1;
+    const int block_lower = floor_div4(i_lower);
+    const int block_upper = floor_div4(i_upper);
+    uint32_t bits[4 * CHUNK_SIZE];
+    double z[4 * CHUNK_SIZE];
+    for (int chunk_lower = block_lower; chunk_lower <= block_upper; chunk_lower += CHUNK_SIZE)
+    {
+        const int num_blocks = std::min(CHUNK_SIZE, block_upper - chunk_lower + 1);
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            const uint32_t ctr[4] = { static_cast<uint32_t>(chunk_lower + b), stream[0], stream[1], stream[2] };
+            philox4x32(ctr, key, &bits[4 * b]);
+        }
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            const double r0 = sqrt(-2.0 * log(u01(bits[4 * b])));
+            const double r1 = sqrt(-2.0 * log(u01(bits[4 * b + 2])));
+            const double theta0 = two_pi * u01(bits[4 * b + 1]);
+            const double theta1 = two_pi * u01(bits[4 * b + 3]);
+            z[4 * b] = r0 * cos(theta0);
+            z[4 * b + 1] = r0 * sin(theta0);
+            z[4 * b + 2] = r1 * cos(theta1);
+            z[4 * b + 3] = r1 * sin(theta1);
+        }
+        const int i_begin = std::max(4 * chunk_lower, i_lower);
+        const int i_end = std::min(4 * (chunk_lower + num_blocks) - 1, i_upper);
+        for (int i = i_begin; i <= i_end; ++i)
+        {
+            values[i - i_lower] = z[i - 4 * chunk_lower];
+        }
+    }
+    return;
+} // genrandn
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
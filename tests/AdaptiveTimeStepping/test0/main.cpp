@@ -0,0 +1,353 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MathUtilities.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyIntegrator.h>
+
+// The rate coefficient lambda(t) of the test equation dy/dt = lambda(t) y, and
+// the exact solution of the test equation with y(0) = 1.
+inline double
+lambda(const double t)
+{
+    return -1.0 - 9.0 * std::pow(std::sin(M_PI * t), 2.0);
+} // lambda
+
+inline double
+exact_solution(const double t)
+{
+    return std::exp(-t - 9.0 * (0.5 * t - std::sin(2.0 * M_PI * t) / (4.0 * M_PI)));
+} // exact_solution
+
+// A hierarchy integrator that solves the test equation with Heun's method.  The
+// first cycle is a forward Euler predictor step, and the second cycle is the
+// trapezoidal corrector step.  The difference between the two is used as the
+// error estimate.  The size and error of each attempted time step are recorded
+// along with whether the time step is accepted.
+class TestODEIntegrator : public HierarchyIntegrator
+{
+public:
+    TestODEIntegrator(const std::string& object_name, Pointer<Database> input_db)
+        : HierarchyIntegrator(object_name, input_db, /*register_for_restart*/ false),
+          d_integrator_is_initialized(false),
+          d_y_current(1.0),
+          d_y_new(std::numeric_limits<double>::quiet_NaN()),
+          d_y_predicted(std::numeric_limits<double>::quiet_NaN()),
+          d_num_resets(0)
+    {
+        return;
+    } // TestODEIntegrator
+
+    void initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
+    {
+        if (d_integrator_is_initialized) return;
+        d_hierarchy = hierarchy;
+        d_gridding_alg = gridding_alg;
+        d_integrator_is_initialized = true;
+        return;
+    } // initializeHierarchyIntegrator
+
+    void preprocessIntegrateHierarchy(const double current_time, const double new_time, const int num_cycles)
+    {
+        HierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
+        d_attempt_dt.push_back(new_time - current_time);
+        d_y_new = d_y_current;
+        return;
+    } // preprocessIntegrateHierarchy
+
+    void integrateHierarchy(const double current_time, const double new_time, const int cycle_num)
+    {
+        HierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
+        const double dt = new_time - current_time;
+        if (cycle_num == 0)
+        {
+            d_y_new = d_y_current + dt * lambda(current_time) * d_y_current;
+            d_y_predicted = d_y_new;
+        }
+        else
+        {
+            d_y_new = d_y_current +
+                      0.5 * dt * (lambda(current_time) * d_y_current + lambda(new_time) * d_y_predicted);
+        }
+        return;
+    } // integrateHierarchy
+
+    void postprocessIntegrateHierarchy(const double current_time,
+                                       const double new_time,
+                                       const bool skip_synchronize_new_state_data,
+                                       const int num_cycles)
+    {
+        d_attempt_error.push_back(getTimeStepErrorEstimateSpecialized());
+        d_attempt_accepted.push_back(true);
+        d_y_current = d_y_new;
+        HierarchyIntegrator::postprocessIntegrateHierarchy(
+            current_time, new_time, skip_synchronize_new_state_data, num_cycles);
+        return;
+    } // postprocessIntegrateHierarchy
+
+    double getSolution() const
+    {
+        return d_y_current;
+    } // getSolution
+
+    int getNumberOfResets() const
+    {
+        return d_num_resets;
+    } // getNumberOfResets
+
+    const std::vector<double>& getAttemptedTimeStepSizes() const
+    {
+        return d_attempt_dt;
+    } // getAttemptedTimeStepSizes
+
+    const std::vector<double>& getAttemptedTimeStepErrors() const
+    {
+        return d_attempt_error;
+    } // getAttemptedTimeStepErrors
+
+    const std::vector<bool>& getAttemptedTimeStepAcceptance() const
+    {
+        return d_attempt_accepted;
+    } // getAttemptedTimeStepAcceptance
+
+protected:
+    double getTimeStepErrorEstimateSpecialized()
+    {
+        return std::abs(d_y_new - d_y_predicted) / std::max(std::abs(d_y_new), 1.0e-12);
+    } // getTimeStepErrorEstimateSpecialized
+
+    void resetIntegratorToPreadvanceStateSpecialized()
+    {
+        d_attempt_error.push_back(getTimeStepErrorEstimateSpecialized());
+        d_attempt_accepted.push_back(false);
+        d_y_new = std::numeric_limits<double>::quiet_NaN();
+        d_y_predicted = std::numeric_limits<double>::quiet_NaN();
+        ++d_num_resets;
+        HierarchyIntegrator::resetIntegratorToPreadvanceStateSpecialized();
+        return;
+    } // resetIntegratorToPreadvanceStateSpecialized
+
+private:
+    bool d_integrator_is_initialized;
+    double d_y_current, d_y_new, d_y_predicted;
+    int d_num_resets;
+    std::vector<double> d_attempt_dt, d_attempt_error;
+    std::vector<bool> d_attempt_accepted;
+};
+
+/*******************************************************************************
+ * Test of the adaptive time step size controller of HierarchyIntegrator.  The *
+ * test equation dy/dt = lambda(t) y is integrated with an error estimate from *
+ * a predictor-corrector method.  The initial time step size is too large, so  *
+ * that time steps are rejected, and the stiffness of the equation varies in   *
+ * time, so that the PI controller must both reduce and increase the time step *
+ * size.  The sizes of all attempted time steps are compared to the sizes      *
+ * prescribed by the controller.                                               *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ODE.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double rel_tol = input_db->getDoubleWithDefault("REL_TOL", 1.0e-10);
+        const double solution_tol = input_db->getDouble("SOLUTION_TOL");
+
+        // Read the controller parameters.
+        Pointer<Database> integrator_db = app_initializer->getComponentDatabase("TestODEIntegrator");
+        const double end_time = integrator_db->getDouble("end_time");
+        const double dt_init = integrator_db->getDouble("dt_init");
+        const double dt_max = integrator_db->getDouble("dt_max");
+        const double grow_dt = integrator_db->getDouble("grow_dt");
+        const double dt_error_tol = integrator_db->getDouble("dt_error_tol");
+        const double safety = integrator_db->getDouble("dt_safety_factor");
+        const double alpha = integrator_db->getDouble("dt_pi_alpha");
+        const double beta = integrator_db->getDouble("dt_pi_beta");
+        const double min_reduction = integrator_db->getDouble("dt_min_reduction_factor");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  The patch hierarchy is not used by the test
+        // integrator, but it is required by HierarchyIntegrator.
+        Pointer<TestODEIntegrator> time_integrator = new TestODEIntegrator("TestODEIntegrator", integrator_db);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        while (!MathUtilities<double>::equalEps(loop_time, end_time) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time = time_integrator->getIntegratorTime();
+        }
+
+        // Check that the attempted time step sizes are the ones prescribed by
+        // the controller.  Following a rejected time step, the time step size
+        // is reduced using the error of the rejected step.  Following an
+        // accepted time step, the PI controller proposes the next time step
+        // size, which is further limited by dt_max, grow_dt, and end_time.
+        const std::vector<double>& attempt_dt = time_integrator->getAttemptedTimeStepSizes();
+        const std::vector<double>& attempt_error = time_integrator->getAttemptedTimeStepErrors();
+        const std::vector<bool>& attempt_accepted = time_integrator->getAttemptedTimeStepAcceptance();
+        const int num_attempts = static_cast<int>(attempt_dt.size());
+        int num_rejected = 0, num_accepted = 0, num_dt_mismatches = 0, num_error_violations = 0;
+        double time = 0.0, error_ratio_previous = 1.0;
+        double dt_accepted_min = std::numeric_limits<double>::max(), dt_accepted_max = 0.0;
+        for (int k = 0; k < num_attempts; ++k)
+        {
+            double dt_expected;
+            if (k == 0)
+            {
+                dt_expected = std::min(std::min(dt_init, dt_max), end_time);
+            }
+            else if (!attempt_accepted[k - 1])
+            {
+                const double error_ratio = attempt_error[k - 1] / dt_error_tol;
+                const double factor = safety * std::pow(error_ratio, -alpha);
+                dt_expected = attempt_dt[k - 1] * std::max(min_reduction, std::min(safety, factor));
+            }
+            else
+            {
+                const double error_ratio = attempt_error[k - 1] / dt_error_tol;
+                const double factor =
+                    safety * std::pow(error_ratio, -alpha) * std::pow(error_ratio_previous, beta);
+                const double growth = std::max(1.0, grow_dt);
+                const double dt_proposed = attempt_dt[k - 1] * std::max(min_reduction, std::min(growth, factor));
+                dt_expected = std::min(std::min(dt_max, growth * attempt_dt[k - 1]), dt_proposed);
+                dt_expected = std::min(dt_expected, end_time - time);
+                error_ratio_previous = std::max(error_ratio, 1.0e-4);
+            }
+            if (std::abs(attempt_dt[k] - dt_expected) > rel_tol * dt_expected) ++num_dt_mismatches;
+            if (attempt_accepted[k])
+            {
+                ++num_accepted;
+                time += attempt_dt[k];
+                dt_accepted_min = std::min(dt_accepted_min, attempt_dt[k]);
+                dt_accepted_max = std::max(dt_accepted_max, attempt_dt[k]);
+                if (attempt_error[k] > dt_error_tol) ++num_error_violations;
+            }
+            else
+            {
+                ++num_rejected;
+            }
+        }
+        const double y_exact = exact_solution(loop_time);
+        const double solution_error = std::abs(time_integrator->getSolution() - y_exact) / y_exact;
+
+        const bool rejections_passed = num_rejected > 0 &&
+                                       num_rejected == time_integrator->getNumberOfRejectedTimeSteps() &&
+                                       num_rejected == time_integrator->getNumberOfResets();
+        const bool controller_passed = num_dt_mismatches == 0 && num_error_violations == 0;
+        const bool adaptivity_passed = dt_accepted_max > 2.0 * dt_accepted_min;
+        const bool solution_passed = solution_error <= solution_tol;
+        if (!rejections_passed) ++num_failures;
+        if (!controller_passed) ++num_failures;
+        if (!adaptivity_passed) ++num_failures;
+        if (!solution_passed) ++num_failures;
+        pout << "accepted time steps:              " << num_accepted << "\n"
+             << "rejected time steps:              " << num_rejected << "\n"
+             << "  " << (rejections_passed ? "PASSED" : "FAILED") << "\n"
+             << "time step sizes not matching the controller: " << num_dt_mismatches << "\n"
+             << "accepted time steps exceeding the error tolerance: " << num_error_violations << "\n"
+             << "  " << (controller_passed ? "PASSED" : "FAILED") << "\n"
+             << "range of accepted time step sizes: [" << dt_accepted_min << "," << dt_accepted_max << "]\n"
+             << "  " << (adaptivity_passed ? "PASSED" : "FAILED") << "\n"
+             << "relative error at time " << loop_time << ": " << solution_error << "\n"
+             << "  " << (solution_passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
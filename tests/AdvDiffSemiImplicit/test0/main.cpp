@@ -0,0 +1,238 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MathUtilities.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// The number of transported quantities.
+static const int NUM_QUANTITIES = 4;
+
+// Advance the transported quantities from their initial values to the end
+// time, with or without batched Helmholtz solves, and return the final values
+// of each quantity on all local patches.  The object names are given a suffix
+// so that each run uses its own variables and patch data.
+void
+run_simulation(Pointer<AppInitializer> app_initializer,
+               const bool batch_helmholtz_solves,
+               const string& suffix,
+               std::vector<std::vector<double> >& Q_final)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    Pointer<Database> integrator_db = app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator");
+    integrator_db->putBool("batch_helmholtz_solves", batch_helmholtz_solves);
+
+    // Create major algorithm and data objects that comprise the application.
+    Pointer<AdvDiffSemiImplicitHierarchyIntegrator> time_integrator =
+        new AdvDiffSemiImplicitHierarchyIntegrator("AdvDiffSemiImplicitHierarchyIntegrator" + suffix, integrator_db);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + suffix, app_initializer->getComponentDatabase("CartesianGeometry"));
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + suffix, grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + suffix,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + suffix, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + suffix,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer);
+
+    // Set up the advection velocity.
+    Pointer<FaceVariable<NDIM, double> > u_adv_var = new FaceVariable<NDIM, double>("u_adv" + suffix);
+    Pointer<CartGridFunction> u_fcn = new muParserCartGridFunction(
+        "u_fcn" + suffix, app_initializer->getComponentDatabase("AdvectionVelocityFunction"), grid_geometry);
+    time_integrator->registerAdvectionVelocity(u_adv_var);
+    time_integrator->setAdvectionVelocityFunction(u_adv_var, u_fcn);
+
+    // Set up the transported quantities.  Quantities 0, 1, and 2 share the same
+    // diffusion and damping coefficients and are solved together when batching
+    // is enabled; only the first of them has a source term.  Quantity 3 has a
+    // different diffusion coefficient and is always solved individually.
+    const double kappa = input_db->getDouble("KAPPA");
+    const double lambda = input_db->getDouble("LAMBDA");
+    const tbox::Array<int> Q_depths = input_db->getIntegerArray("Q_DEPTHS");
+    std::vector<Pointer<CellVariable<NDIM, double> > > Q_vars(NUM_QUANTITIES);
+    for (int k = 0; k < NUM_QUANTITIES; ++k)
+    {
+        ostringstream Q_name_stream;
+        Q_name_stream << "Q" << k;
+        const string Q_name = Q_name_stream.str();
+        Pointer<Database> Q_init_db = app_initializer->getComponentDatabase(Q_name + "InitialConditions");
+        Q_vars[k] = new CellVariable<NDIM, double>(Q_name + suffix, Q_depths[k]);
+        Pointer<CartGridFunction> Q_init =
+            new muParserCartGridFunction(Q_name + "_init" + suffix, Q_init_db, grid_geometry);
+        time_integrator->registerTransportedQuantity(Q_vars[k]);
+        time_integrator->setAdvectionVelocity(Q_vars[k], u_adv_var);
+        time_integrator->setInitialConditions(Q_vars[k], Q_init);
+        time_integrator->setDiffusionCoefficient(Q_vars[k], k < NUM_QUANTITIES - 1 ? kappa : 2.0 * kappa);
+        time_integrator->setDampingCoefficient(Q_vars[k], lambda);
+    }
+    Pointer<CellVariable<NDIM, double> > F_var = new CellVariable<NDIM, double>("F" + suffix);
+    Pointer<CartGridFunction> F_fcn = new muParserCartGridFunction(
+        "F_fcn" + suffix, app_initializer->getComponentDatabase("ForcingFunction"), grid_geometry);
+    time_integrator->registerSourceTerm(F_var);
+    time_integrator->setSourceTermFunction(F_var, F_fcn);
+    time_integrator->setSourceTerm(Q_vars[0], F_var);
+
+    // Initialize hierarchy configuration and data on all patches.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+    pout << "completed " << time_integrator->getIntegratorStep() << " time steps with batched Helmholtz solves "
+         << (batch_helmholtz_solves ? "enabled" : "disabled") << "\n";
+
+    // Extract the final values of the transported quantities.  Both runs use
+    // the same grid configuration and load balancing, so the values are stored
+    // in the same order in each run.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Q_final.resize(NUM_QUANTITIES);
+    for (int k = 0; k < NUM_QUANTITIES; ++k)
+    {
+        const int Q_idx = var_db->mapVariableAndContextToIndex(Q_vars[k], time_integrator->getCurrentContext());
+        Q_final[k].clear();
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+                {
+                    for (int d = 0; d < Q_data->getDepth(); ++d) Q_final[k].push_back((*Q_data)(ic(), d));
+                }
+            }
+        }
+    }
+    return;
+} // run_simulation
+
+/*******************************************************************************
+ * Regression test for batched Helmholtz solves in                             *
+ * AdvDiffSemiImplicitHierarchyIntegrator (input key batch_helmholtz_solves).  *
+ * Several quantities are advected and diffused on a locally refined grid.     *
+ * The simulation is run once with each quantity solved individually and once  *
+ * with the quantities that share diffusion and damping coefficients solved    *
+ * together, and the final values of the quantities are compared.              *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double rel_tol = input_db->getDouble("REL_TOL");
+
+        // Run the simulations.
+        std::vector<std::vector<double> > Q_individual, Q_batched;
+        run_simulation(app_initializer, false, "_individual", Q_individual);
+        run_simulation(app_initializer, true, "_batched", Q_batched);
+
+        // Compare the final values of each quantity.  The difference between the
+        // two runs is measured relative to the magnitude of the quantity.
+        for (int k = 0; k < NUM_QUANTITIES; ++k)
+        {
+            double Q_max_norm = 0.0, diff_max_norm = 0.0;
+            for (unsigned int i = 0; i < Q_individual[k].size(); ++i)
+            {
+                Q_max_norm = std::max(Q_max_norm, std::abs(Q_individual[k][i]));
+                diff_max_norm = std::max(diff_max_norm, std::abs(Q_batched[k][i] - Q_individual[k][i]));
+            }
+            Q_max_norm = SAMRAI_MPI::maxReduction(Q_max_norm);
+            diff_max_norm = SAMRAI_MPI::maxReduction(diff_max_norm);
+            const bool passed = Q_batched[k].size() == Q_individual[k].size() && Q_max_norm > 0.0 &&
+                                diff_max_norm <= rel_tol * Q_max_norm;
+            if (!passed) ++num_failures;
+            pout << "Q" << k << ":\n"
+                 << "  max-norm of the quantity:                   " << Q_max_norm << "\n"
+                 << "  max-norm of the difference between the runs: " << diff_max_norm << "\n"
+                 << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
@@ -0,0 +1,201 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/INSStaggeredPPMConvectiveOperator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+/*******************************************************************************
+ * Regression test for INSStaggeredPPMConvectiveOperator.  The convective      *
+ * derivative of the initial velocity field is computed using both the fused   *
+ * tiled kernel and the original multi-pass implementation for each            *
+ * differencing form, and the results are required to agree.                   *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double rel_tol = input_db->getDoubleWithDefault("REL_TOL", 1.0e-12);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  The Navier-Stokes integrator is only used to generate
+        // the patch hierarchy and the initial velocity field.
+        Pointer<INSStaggeredHierarchyIntegrator> time_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create initial condition specification objects.  The domain is
+        // periodic, so that no physical boundary conditions are required.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        time_integrator->registerVelocityInitialConditions(u_init);
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Setup the velocity and convective derivative data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<Variable<NDIM> > u_var = time_integrator->getVelocityVariable();
+        const Pointer<VariableContext> u_ctx = time_integrator->getCurrentContext();
+        const int u_idx = var_db->mapVariableAndContextToIndex(u_var, u_ctx);
+        const int N_fused_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+        const int N_multipass_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        const double loop_time = time_integrator->getIntegratorTime();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(N_fused_idx, loop_time);
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(N_multipass_idx, loop_time);
+        }
+
+        HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+        hier_math_ops.setPatchHierarchy(patch_hierarchy);
+        hier_math_ops.resetLevels(coarsest_ln, finest_ln);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, coarsest_ln, finest_ln);
+        u_vec.addComponent(u_var, u_idx, wgt_sc_idx);
+        SAMRAIVectorReal<NDIM, double> N_fused_vec("N_fused", patch_hierarchy, coarsest_ln, finest_ln);
+        N_fused_vec.addComponent(u_var, N_fused_idx, wgt_sc_idx);
+        SAMRAIVectorReal<NDIM, double> N_multipass_vec("N_multipass", patch_hierarchy, coarsest_ln, finest_ln);
+        N_multipass_vec.addComponent(u_var, N_multipass_idx, wgt_sc_idx);
+
+        Pointer<Database> fused_db = new MemoryDatabase("fused_db");
+        fused_db->putBool("use_fused_ppm_kernel", true);
+        Pointer<Database> multipass_db = new MemoryDatabase("multipass_db");
+        multipass_db->putBool("use_fused_ppm_kernel", false);
+
+        // Compare the two implementations for each differencing form.
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+        const ConvectiveDifferencingType difference_forms[3] = { ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC };
+        for (int k = 0; k < 3; ++k)
+        {
+            const ConvectiveDifferencingType difference_form = difference_forms[k];
+            INSStaggeredPPMConvectiveOperator fused_op("fused_op", fused_db, difference_form, u_bc_coefs);
+            INSStaggeredPPMConvectiveOperator multipass_op("multipass_op", multipass_db, difference_form, u_bc_coefs);
+
+            fused_op.setAdvectionVelocity(u_idx);
+            fused_op.setSolutionTime(loop_time);
+            fused_op.initializeOperatorState(u_vec, N_fused_vec);
+            fused_op.apply(u_vec, N_fused_vec);
+
+            multipass_op.setAdvectionVelocity(u_idx);
+            multipass_op.setSolutionTime(loop_time);
+            multipass_op.initializeOperatorState(u_vec, N_multipass_vec);
+            multipass_op.apply(u_vec, N_multipass_vec);
+
+            const double N_max_norm = hier_sc_data_ops.maxNorm(N_multipass_idx, wgt_sc_idx);
+            hier_sc_data_ops.subtract(N_fused_idx, N_fused_idx, N_multipass_idx);
+            const double diff_max_norm = hier_sc_data_ops.maxNorm(N_fused_idx, wgt_sc_idx);
+            const bool passed = diff_max_norm <= rel_tol * N_max_norm;
+            if (!passed) ++num_failures;
+            pout << enum_to_string<ConvectiveDifferencingType>(difference_form) << ":\n"
+                 << "  max-norm of N:              " << N_max_norm << "\n"
+                 << "  max-norm of the difference: " << diff_max_norm << "\n"
+                 << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+        }
+
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(N_fused_idx);
+            patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(N_multipass_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
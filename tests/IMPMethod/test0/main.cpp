@@ -0,0 +1,327 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MathUtilities.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IMPInitializer.h>
+#include <ibamr/IMPMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Elasticity model data.
+namespace ModelData
+{
+// Stress tensor function.
+static double c1_s = 0.05;
+static double beta_s = 0.0;
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*x*/,
+                    const libMesh::Point& /*X*/,
+                    subdomain_id_type /*subdomain_id*/,
+                    std::vector<double>& /*internal_vars*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    const TensorValue<double> FF_inv_trans = tensor_inverse_transpose(FF, NDIM);
+    const TensorValue<double> CC = FF.transpose() * FF;
+    PP = 2.0 * c1_s * (FF - FF_inv_trans) + beta_s * log(CC.det()) * FF_inv_trans;
+    return;
+} // PK1_stress_function
+
+// Batched stress tensor function that evaluates the same constitutive law.
+void
+PK1_stress_batch_function(std::vector<TensorValue<double> >& PP,
+                          const std::vector<TensorValue<double> >& FF,
+                          const std::vector<libMesh::Point>& x,
+                          const std::vector<libMesh::Point>& X,
+                          const std::vector<subdomain_id_type>& subdomain_ids,
+                          const std::vector<std::vector<double>*>& internal_vars,
+                          double time,
+                          void* ctx)
+{
+    for (unsigned int k = 0; k < PP.size(); ++k)
+    {
+        PK1_stress_function(PP[k], FF[k], x[k], X[k], subdomain_ids[k], *internal_vars[k], time, ctx);
+    }
+    return;
+} // PK1_stress_batch_function
+}
+using namespace ModelData;
+
+// Advance the elastic block from its initial configuration to the end time and
+// return the final positions and deformation gradients of the material points,
+// ordered by Lagrangian index.  The object names are given a suffix so that
+// each run uses its own Lagrangian data manager and patch data.
+void
+run_simulation(Pointer<AppInitializer> app_initializer,
+               MeshBase* mesh,
+               const bool use_batch_fcn,
+               const string& suffix,
+               std::vector<double>& X_final,
+               std::vector<double>& F_final)
+{
+    // Create major algorithm and data objects that comprise the application.
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+        "INSStaggeredHierarchyIntegrator" + suffix,
+        app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+    Pointer<IMPMethod> ib_method_ops =
+        new IMPMethod("IMPMethod" + suffix, app_initializer->getComponentDatabase("IMPMethod"));
+    Pointer<IBHierarchyIntegrator> time_integrator =
+        new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator" + suffix,
+                                          app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                          ib_method_ops,
+                                          navier_stokes_integrator);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + suffix, app_initializer->getComponentDatabase("CartesianGeometry"));
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + suffix, grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + suffix,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + suffix, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + suffix,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer);
+
+    // Configure the IMP solver.
+    Pointer<IMPInitializer> ib_initializer =
+        new IMPInitializer("IMPInitializer" + suffix,
+                           app_initializer->getComponentDatabase("IMPInitializer"),
+                           patch_hierarchy,
+                           gridding_algorithm);
+    ib_initializer->registerMesh(mesh);
+    if (use_batch_fcn)
+    {
+        ib_method_ops->registerPK1StressTensorFunction(PK1_stress_batch_function);
+    }
+    else
+    {
+        ib_method_ops->registerPK1StressTensorFunction(PK1_stress_function);
+    }
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+
+    // Set the initial fluid velocity, which deforms the structure.
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init" + suffix, app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize hierarchy configuration and data on all patches.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+    pout << "completed " << time_integrator->getIntegratorStep() << " time steps using the "
+         << (use_batch_fcn ? "batched" : "pointwise") << " PK1 stress function\n";
+
+    // Extract the final positions and deformation gradients.
+    LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+    Pointer<LData> F_data = l_data_manager->getLData("F", ln);
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    const boost::multi_array_ref<double, 2>& F_array = *F_data->getLocalFormVecArray();
+    const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(ln)->getLocalNodes();
+    X_final.resize(NDIM * local_nodes.size());
+    F_final.resize(NDIM * NDIM * local_nodes.size());
+    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    {
+        const int lag_idx = (*cit)->getLagrangianIndex();
+        const int local_idx = (*cit)->getLocalPETScIndex();
+        for (int d = 0; d < NDIM; ++d) X_final[NDIM * lag_idx + d] = X_array[local_idx][d];
+        for (int d = 0; d < NDIM * NDIM; ++d) F_final[NDIM * NDIM * lag_idx + d] = F_array[local_idx][d];
+    }
+    X_data->restoreArrays();
+    F_data->restoreArrays();
+    return;
+} // run_simulation
+
+// Compare two sets of values and report whether they agree to the specified
+// relative tolerance.
+bool
+compare_values(const std::vector<double>& a, const std::vector<double>& b, const double rel_tol, const string& name)
+{
+    double max_norm = 0.0, diff_max_norm = 0.0;
+    for (unsigned int i = 0; i < a.size(); ++i)
+    {
+        max_norm = std::max(max_norm, std::abs(a[i]));
+        diff_max_norm = std::max(diff_max_norm, std::abs(a[i] - b[i]));
+    }
+    const bool passed = a.size() == b.size() && max_norm > 0.0 && diff_max_norm <= rel_tol * max_norm;
+    pout << "  max-norm of the difference in " << name << ": " << diff_max_norm << (passed ? "" : "  FAILED")
+         << "\n";
+    return passed;
+} // compare_values
+
+/*******************************************************************************
+ * Regression test for the threaded and batched code paths of IMPMethod.  An   *
+ * elastic block is deformed by an initial shear flow.  The simulation is run  *
+ * three times: with a pointwise PK1 stress function on a single thread, with  *
+ * the same function on all available threads, and with a batched PK1 stress   *
+ * function on all available threads.  The final positions and deformation     *
+ * gradients of the material points are required to agree to round-off.  This  *
+ * test must be run on a single processor.                                     *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IMP.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        if (SAMRAI_MPI::getNodes() != 1)
+        {
+            TBOX_ERROR("This test must be run on a single processor.\n");
+        }
+        c1_s = input_db->getDouble("C1_S");
+        beta_s = input_db->getDouble("BETA_S");
+        const double rel_tol = input_db->getDouble("REL_TOL");
+
+        // Create a block of material points.
+        Mesh mesh(init.comm(), NDIM);
+        const tbox::Array<double> block_lower = input_db->getDoubleArray("BLOCK_LOWER");
+        const tbox::Array<double> block_upper = input_db->getDoubleArray("BLOCK_UPPER");
+        const int num_elems = input_db->getInteger("NUM_ELEMS");
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh,
+                                            num_elems,
+                                            num_elems,
+                                            block_lower[0],
+                                            block_upper[0],
+                                            block_lower[1],
+                                            block_upper[1],
+                                            Utility::string_to_enum<ElemType>("QUAD4"));
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(mesh,
+                                          num_elems,
+                                          num_elems,
+                                          num_elems,
+                                          block_lower[0],
+                                          block_upper[0],
+                                          block_lower[1],
+                                          block_upper[1],
+                                          block_lower[2],
+                                          block_upper[2],
+                                          Utility::string_to_enum<ElemType>("HEX8"));
+#endif
+        mesh.prepare_for_use();
+
+        // Run the simulations.  The reference run uses a single thread.
+        std::vector<double> X_serial, F_serial, X_threaded, F_threaded, X_batched, F_batched;
+#if defined(_OPENMP)
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+#endif
+        run_simulation(app_initializer, &mesh, false, "_serial", X_serial, F_serial);
+#if defined(_OPENMP)
+        omp_set_num_threads(max_threads);
+        pout << "using " << max_threads << " thread(s) for the threaded runs\n";
+#endif
+        run_simulation(app_initializer, &mesh, false, "_threaded", X_threaded, F_threaded);
+        run_simulation(app_initializer, &mesh, true, "_batched", X_batched, F_batched);
+
+        // Compare the results of the runs.
+        pout << "threaded vs. serial run:\n";
+        if (!compare_values(X_serial, X_threaded, rel_tol, "X")) ++num_failures;
+        if (!compare_values(F_serial, F_threaded, rel_tol, "F")) ++num_failures;
+        pout << "batched vs. pointwise PK1 stress function:\n";
+        if (!compare_values(X_threaded, X_batched, rel_tol, "X")) ++num_failures;
+        if (!compare_values(F_threaded, F_batched, rel_tol, "F")) ++num_failures;
+        pout << (num_failures == 0 ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    return num_failures;
+} // main
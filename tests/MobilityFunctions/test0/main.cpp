@@ -0,0 +1,212 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/MobilityFunctions.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+
+// Deterministic jitter in [-1,1].
+inline double
+jitter(const int i, const int d)
+{
+    return sin(12.9898 * static_cast<double>(i) + 78.233 * static_cast<double>(d + 1));
+} // jitter
+
+// Append a cluster of markers on a jittered Cartesian lattice with the given
+// lower corner and lattice spacing.
+void
+add_lattice_cluster(std::vector<double>& X, const double* X_lower, const int num_markers_per_dim, const double spacing)
+{
+    const int offset = static_cast<int>(X.size()) / NDIM;
+    int num_markers = 1;
+    for (int d = 0; d < NDIM; ++d) num_markers *= num_markers_per_dim;
+    for (int i = 0; i < num_markers; ++i)
+    {
+        for (int d = 0, stride = 1; d < NDIM; ++d, stride *= num_markers_per_dim)
+        {
+            const int i_d = (i / stride) % num_markers_per_dim;
+            X.push_back(X_lower[d] + (static_cast<double>(i_d) + 0.25 * jitter(offset + i, d)) * spacing);
+        }
+    }
+    return;
+} // add_lattice_cluster
+
+// Compute U = M F using the dense RPY mobility matrix M, which is stored in
+// column-major order.
+void
+apply_dense_mobility_matrix(const char* kernel_name,
+                            const double mu,
+                            const double dx,
+                            const std::vector<double>& X,
+                            const double periodic_correction,
+                            const std::vector<double>& F,
+                            std::vector<double>& U)
+{
+    const int size = static_cast<int>(X.size());
+    std::vector<double> MM(size * size);
+    MobilityFunctions::constructRPYMobilityMatrix(
+        kernel_name, mu, dx, &X[0], size / NDIM, periodic_correction, &MM[0]);
+    U.assign(size, 0.0);
+    for (int col = 0; col < size; ++col)
+    {
+        for (int row = 0; row < size; ++row) U[row] += MM[col * size + row] * F[col];
+    }
+    return;
+} // apply_dense_mobility_matrix
+
+/*******************************************************************************
+ * Regression test for MobilityFunctions::applyRPYMobilityMatrix().  Products  *
+ * computed using the cluster tree are compared to products with the dense RPY *
+ * mobility matrix for a near-field configuration, in which the markers of a   *
+ * single jittered lattice are closer than the hydrodynamic diameter, and for  *
+ * a far-field configuration, in which compact clusters of markers are placed  *
+ * at the corners of a large cube.  The products are required to agree to     *
+ * within REL_TOLS(k) for opening angle OPENING_ANGLES(k).                     *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "Mobility.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const string kernel_name = input_db->getString("KERNEL");
+        const double mu = input_db->getDouble("MU");
+        const double dx = input_db->getDouble("DX");
+        const double periodic_correction = input_db->getDouble("PERIODIC_CORRECTION");
+        const Array<double> opening_angles = input_db->getDoubleArray("OPENING_ANGLES");
+        const Array<double> rel_tols = input_db->getDoubleArray("REL_TOLS");
+        if (opening_angles.size() != rel_tols.size())
+        {
+            TBOX_ERROR("OPENING_ANGLES and REL_TOLS must have the same number of entries.\n");
+        }
+
+        // Set up the marker configurations.
+        std::vector<std::vector<double> > X(2);
+        const char* const config_names[2] = { "near-field", "far-field" };
+        double X_lower[NDIM];
+        for (int d = 0; d < NDIM; ++d) X_lower[d] = 0.0;
+        add_lattice_cluster(X[0],
+                            X_lower,
+                            input_db->getInteger("NEAR_FIELD_MARKERS_PER_DIM"),
+                            input_db->getDouble("NEAR_FIELD_SPACING"));
+        const double far_field_separation = input_db->getDouble("FAR_FIELD_SEPARATION");
+        for (int c = 0; c < (1 << NDIM); ++c)
+        {
+            for (int d = 0; d < NDIM; ++d) X_lower[d] = static_cast<double>((c >> d) & 1) * far_field_separation;
+            add_lattice_cluster(X[1],
+                                X_lower,
+                                input_db->getInteger("FAR_FIELD_MARKERS_PER_DIM"),
+                                input_db->getDouble("FAR_FIELD_SPACING"));
+        }
+
+        // Compare the products computed using the cluster tree to the products
+        // computed using the dense mobility matrix.
+        for (int k = 0; k < 2; ++k)
+        {
+            const int num_markers = static_cast<int>(X[k].size()) / NDIM;
+            std::vector<double> F(num_markers * NDIM), U_dense, U_tree(num_markers * NDIM);
+            for (int i = 0; i < num_markers; ++i)
+            {
+                for (int d = 0; d < NDIM; ++d) F[i * NDIM + d] = jitter(i + 7, d + 3);
+            }
+            double start_time = MPI_Wtime();
+            apply_dense_mobility_matrix(kernel_name.c_str(), mu, dx, X[k], periodic_correction, F, U_dense);
+            const double dense_time = MPI_Wtime() - start_time;
+            double U_max_norm = 0.0;
+            for (int i = 0; i < num_markers * NDIM; ++i) U_max_norm = std::max(U_max_norm, std::abs(U_dense[i]));
+            pout << config_names[k] << " configuration with " << num_markers << " markers:\n"
+                 << "  max-norm of M F:    " << U_max_norm << "\n"
+                 << "  dense product time: " << dense_time << " s\n";
+
+            for (int n = 0; n < opening_angles.size(); ++n)
+            {
+                start_time = MPI_Wtime();
+                MobilityFunctions::applyRPYMobilityMatrix(kernel_name.c_str(),
+                                                          mu,
+                                                          dx,
+                                                          &X[k][0],
+                                                          num_markers,
+                                                          periodic_correction,
+                                                          &F[0],
+                                                          &U_tree[0],
+                                                          opening_angles[n]);
+                const double tree_time = MPI_Wtime() - start_time;
+                double diff_max_norm = 0.0;
+                for (int i = 0; i < num_markers * NDIM; ++i)
+                {
+                    diff_max_norm = std::max(diff_max_norm, std::abs(U_tree[i] - U_dense[i]));
+                }
+
+                const bool passed = U_max_norm > 0.0 && diff_max_norm <= rel_tols[n] * U_max_norm;
+                if (!passed) ++num_failures;
+                pout << "  opening angle " << opening_angles[n] << ":\n"
+                     << "    max-norm of the difference: " << diff_max_norm << "\n"
+                     << "    tree product time:          " << tree_time << " s\n"
+                     << "    " << (passed ? "PASSED" : "FAILED") << "\n";
+            }
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
@@ -0,0 +1,233 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MathUtilities.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+// Advance the elastic ring from its initial configuration to the end time,
+// using the specified number of structure substeps per fluid time step, and
+// return the final node positions ordered by Lagrangian index.  The object
+// names are given a suffix so that each run uses its own Lagrangian data
+// manager and patch data.
+void
+run_simulation(Pointer<AppInitializer> app_initializer,
+               const int num_structure_substeps,
+               const string& suffix,
+               std::vector<double>& X_final)
+{
+    Pointer<Database> ib_hier_integrator_db = app_initializer->getComponentDatabase("IBHierarchyIntegrator");
+    ib_hier_integrator_db->putInteger("num_structure_substeps", num_structure_substeps);
+
+    // Create major algorithm and data objects that comprise the application.
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+        "INSStaggeredHierarchyIntegrator" + suffix,
+        app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+    Pointer<IBMethod> ib_method_ops =
+        new IBMethod("IBMethod" + suffix, app_initializer->getComponentDatabase("IBMethod"));
+    Pointer<IBHierarchyIntegrator> time_integrator = new IBExplicitHierarchyIntegrator(
+        "IBHierarchyIntegrator" + suffix, ib_hier_integrator_db, ib_method_ops, navier_stokes_integrator);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + suffix, app_initializer->getComponentDatabase("CartesianGeometry"));
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + suffix, grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + suffix,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + suffix, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + suffix,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer);
+
+    // Configure the IB solver.
+    Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+        "IBStandardInitializer" + suffix, app_initializer->getComponentDatabase("IBStandardInitializer"));
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+    Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+    ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+    // Initialize hierarchy configuration and data on all patches.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+    pout << "completed " << time_integrator->getIntegratorStep() << " time steps with " << num_structure_substeps
+         << " structure substep(s) per time step\n";
+
+    // Extract the final node positions.
+    LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    const std::vector<LNode*>& local_nodes = l_data_manager->getLMesh(ln)->getLocalNodes();
+    X_final.resize(NDIM * local_nodes.size());
+    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    {
+        const int lag_idx = (*cit)->getLagrangianIndex();
+        const int local_idx = (*cit)->getLocalPETScIndex();
+        for (int d = 0; d < NDIM; ++d) X_final[NDIM * lag_idx + d] = X_array[local_idx][d];
+    }
+    X_data->restoreArrays();
+    return;
+} // run_simulation
+
+/*******************************************************************************
+ * Regression test for multirate structure subcycling in                      *
+ * IBExplicitHierarchyIntegrator.  An elastic ring that is initially an        *
+ * ellipse relaxes in a viscous fluid.  The simulation is run once with a      *
+ * single structure step per fluid time step and once with NUM_SUBSTEPS        *
+ * structure substeps per fluid time step, and the final node positions of     *
+ * the two runs are compared.  This test must be run on a single processor.    *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        if (SAMRAI_MPI::getNodes() != 1)
+        {
+            TBOX_ERROR("This test must be run on a single processor.\n");
+        }
+        const int num_substeps = input_db->getInteger("NUM_SUBSTEPS");
+        const int num_nodes = input_db->getInteger("NUM_NODES");
+        const double alpha = input_db->getDouble("ALPHA");
+        const double beta = input_db->getDouble("BETA");
+        const double rel_tol = input_db->getDouble("REL_TOL");
+
+        // Write the vertex and spring files for an elliptical ring of nodes
+        // connected by linear springs with zero rest length.  The files must
+        // exist before the IBStandardInitializer objects are created.
+        Pointer<Database> ib_initializer_db = app_initializer->getComponentDatabase("IBStandardInitializer");
+        const string structure_name = ib_initializer_db->getStringArray("structure_names")[0];
+        std::vector<double> X_init(NDIM * num_nodes);
+        {
+            ofstream vertex_stream((structure_name + ".vertex").c_str());
+            ofstream spring_stream((structure_name + ".spring").c_str());
+            vertex_stream.precision(16);
+            vertex_stream << num_nodes << "\n";
+            spring_stream << num_nodes << "\n";
+            for (int i = 0; i < num_nodes; ++i)
+            {
+                const double theta = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(num_nodes);
+                for (int d = 0; d < NDIM; ++d) X_init[NDIM * i + d] = 0.5;
+                X_init[NDIM * i] += alpha * cos(theta);
+                X_init[NDIM * i + 1] += beta * sin(theta);
+                for (int d = 0; d < NDIM; ++d) vertex_stream << X_init[NDIM * i + d] << (d < NDIM - 1 ? " " : "\n");
+                spring_stream << i << " " << (i + 1) % num_nodes << " 1.0 0.0\n";
+            }
+        }
+
+        // Run the simulations.
+        std::vector<double> X_single, X_multi;
+        run_simulation(app_initializer, 1, "_single", X_single);
+        run_simulation(app_initializer, num_substeps, "_multi", X_multi);
+
+        // Compare the final node positions.  The difference between the two runs
+        // is measured relative to the displacement of the structure.
+        double displacement_max_norm = 0.0, diff_max_norm = 0.0;
+        for (int i = 0; i < NDIM * num_nodes; ++i)
+        {
+            displacement_max_norm = std::max(displacement_max_norm, std::abs(X_single[i] - X_init[i]));
+            diff_max_norm = std::max(diff_max_norm, std::abs(X_multi[i] - X_single[i]));
+        }
+        const bool passed = displacement_max_norm > 0.0 && diff_max_norm <= rel_tol * displacement_max_norm;
+        if (!passed) ++num_failures;
+        pout << "max-norm of the displacement of the structure: " << displacement_max_norm << "\n"
+             << "max-norm of the difference between the runs:   " << diff_max_norm << "\n"
+             << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
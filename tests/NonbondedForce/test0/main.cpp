@@ -0,0 +1,305 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+// Soft-sphere repulsion between nodes that are closer than r0 = params[1].
+void
+soft_sphere_force(double* D, const Array<double> params, double* out_force)
+{
+    const double k = params[0];
+    const double r0 = params[1];
+    double r_sq = 0.0;
+    for (int d = 0; d < NDIM; ++d) r_sq += D[d] * D[d];
+    const double r = sqrt(r_sq);
+    const double f = (r > 0.0 && r < r0) ? k * (r0 - r) / r : 0.0;
+    for (int d = 0; d < NDIM; ++d) out_force[d] = f * D[d];
+    return;
+} // soft_sphere_force
+
+// Compute the pair forces by visiting every pair of nodes, using the minimum
+// image convention in the periodic domain [0,L]^NDIM.
+void
+compute_brute_force(const double* X, const int num_nodes, const double L, const Array<double>& params, double* F)
+{
+    std::fill(F, F + num_nodes * NDIM, 0.0);
+    double D[NDIM], pair_force[NDIM];
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        for (int j = i + 1; j < num_nodes; ++j)
+        {
+            for (int d = 0; d < NDIM; ++d)
+            {
+                D[d] = X[i * NDIM + d] - X[j * NDIM + d];
+                D[d] -= L * floor(D[d] / L + 0.5);
+            }
+            soft_sphere_force(D, params, pair_force);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F[i * NDIM + d] += pair_force[d];
+                F[j * NDIM + d] -= pair_force[d];
+            }
+        }
+    }
+    return;
+} // compute_brute_force
+
+// Deterministic jitter in [-1,1].
+inline double
+jitter(const int i, const int d)
+{
+    return sin(12.9898 * static_cast<double>(i) + 78.233 * static_cast<double>(d + 1));
+} // jitter
+
+/*******************************************************************************
+ * Regression test and benchmark for NonbondedForceEvaluator.  Pair forces     *
+ * between the nodes of a jittered lattice are computed from the neighbor list *
+ * and are compared to forces computed by visiting every pair of nodes.  The   *
+ * comparison is repeated after the nodes are perturbed by less than half of   *
+ * the neighbor list skin, so that the neighbor list is reused.  This test     *
+ * must be run on a single processor.                                          *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        if (SAMRAI_MPI::getNodes() != 1)
+        {
+            TBOX_ERROR("This test must be run on a single processor.\n");
+        }
+        const double L = input_db->getDouble("L");
+        const int num_nodes_per_dim = input_db->getInteger("NUM_NODES_PER_DIM");
+        const double rel_tol = input_db->getDoubleWithDefault("REL_TOL", 1.0e-12);
+        const int num_timing_repeats = input_db->getIntegerWithDefault("NUM_TIMING_REPEATS", 10);
+
+        // Write the vertex file for a jittered lattice of nodes.  The vertex
+        // file must exist before the IBStandardInitializer is created.
+        Pointer<Database> ib_initializer_db = app_initializer->getComponentDatabase("IBStandardInitializer");
+        const string structure_name = ib_initializer_db->getStringArray("structure_names")[0];
+        int num_nodes = 1;
+        for (int d = 0; d < NDIM; ++d) num_nodes *= num_nodes_per_dim;
+        {
+            const double h = L / static_cast<double>(num_nodes_per_dim);
+            ofstream vertex_stream((structure_name + ".vertex").c_str());
+            vertex_stream.precision(16);
+            vertex_stream << num_nodes << "\n";
+            for (int i = 0; i < num_nodes; ++i)
+            {
+                for (int d = 0, stride = 1; d < NDIM; ++d, stride *= num_nodes_per_dim)
+                {
+                    const int i_d = (i / stride) % num_nodes_per_dim;
+                    vertex_stream << (static_cast<double>(i_d) + 0.5 + 0.2 * jitter(i, d)) * h
+                                  << (d < NDIM - 1 ? " " : "\n");
+                }
+            }
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.  The IB integrator is only used to generate the patch
+        // hierarchy and the Lagrangian data.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer =
+            new IBStandardInitializer("IBStandardInitializer", ib_initializer_db);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Setup the nonbonded force evaluator.
+        NonbondedForceEvaluator nonbonded_force_evaluator(
+            app_initializer->getComponentDatabase("NonbondedForceEvaluator"), grid_geometry);
+        nonbonded_force_evaluator.registerForceFcnPtr(&soft_sphere_force);
+        const Array<double> params =
+            app_initializer->getComponentDatabase("NonbondedForceEvaluator")->getDoubleArray("parameters");
+        const double skin =
+            app_initializer->getComponentDatabase("NonbondedForceEvaluator")->getDouble("neighbor_list_skin");
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Setup the Lagrangian position and force data.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> F_data = l_data_manager->createLData("F_nonbonded", ln, NDIM);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+        std::vector<double> F_brute_force(num_nodes * NDIM);
+
+        // Compare the pair forces to the brute-force forces for the initial and
+        // the perturbed node positions.
+        for (int k = 0; k < 2; ++k)
+        {
+            if (k == 1)
+            {
+                double* X;
+                VecGetArray(X_data->getVec(), &X);
+                for (int i = 0; i < num_nodes; ++i)
+                {
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        X[i * NDIM + d] += 0.2 * skin * jitter(i + num_nodes, d);
+                    }
+                }
+                VecRestoreArray(X_data->getVec(), &X);
+            }
+
+            VecSet(F_data->getVec(), 0.0);
+            nonbonded_force_evaluator.computeLagrangianForce(
+                F_data, X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+
+            const double* X;
+            VecGetArrayRead(X_data->getVec(), &X);
+            const double* F;
+            VecGetArrayRead(F_data->getVec(), &F);
+            compute_brute_force(X, num_nodes, L, params, &F_brute_force[0]);
+            double F_max_norm = 0.0, diff_max_norm = 0.0;
+            for (int i = 0; i < num_nodes * NDIM; ++i)
+            {
+                F_max_norm = std::max(F_max_norm, std::abs(F_brute_force[i]));
+                diff_max_norm = std::max(diff_max_norm, std::abs(F[i] - F_brute_force[i]));
+            }
+            VecRestoreArrayRead(F_data->getVec(), &F);
+            VecRestoreArrayRead(X_data->getVec(), &X);
+
+            const bool passed = F_max_norm > 0.0 && diff_max_norm <= rel_tol * F_max_norm;
+            if (!passed) ++num_failures;
+            pout << (k == 0 ? "initial" : "perturbed") << " node positions:\n"
+                 << "  max-norm of F:              " << F_max_norm << "\n"
+                 << "  max-norm of the difference: " << diff_max_norm << "\n"
+                 << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+        }
+
+        // Time the neighbor list traversal and the brute-force computation.
+        const double* X;
+        VecGetArrayRead(X_data->getVec(), &X);
+        double start_time = MPI_Wtime();
+        for (int n = 0; n < num_timing_repeats; ++n)
+        {
+            compute_brute_force(X, num_nodes, L, params, &F_brute_force[0]);
+        }
+        const double brute_force_time = (MPI_Wtime() - start_time) / static_cast<double>(num_timing_repeats);
+        VecRestoreArrayRead(X_data->getVec(), &X);
+        start_time = MPI_Wtime();
+        for (int n = 0; n < num_timing_repeats; ++n)
+        {
+            nonbonded_force_evaluator.computeLagrangianForce(
+                F_data, X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+        }
+        const double neighbor_list_time = (MPI_Wtime() - start_time) / static_cast<double>(num_timing_repeats);
+        pout << "average time per evaluation for " << num_nodes << " nodes:\n"
+             << "  neighbor list: " << neighbor_list_time << " s\n"
+             << "  brute force:   " << brute_force_time << " s\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
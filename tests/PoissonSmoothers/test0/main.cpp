@@ -0,0 +1,309 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <ArrayData.h>
+#include <Box.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PoissonSmoothers.h>
+
+// FORTRAN ROUTINES
+#if (NDIM == 2)
+#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#endif
+#if (NDIM == 3)
+#define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#endif
+
+// Function interfaces
+extern "C" {
+void RB_GS_SMOOTH_FC(double* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const double* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx,
+                     const int& red_or_black);
+
+void RB_GS_SMOOTH_MASK_FC(double* U,
+                          const int& U_gcw,
+                          const double& alpha,
+                          const double& beta,
+                          const double* F,
+                          const int& F_gcw,
+                          const int* mask,
+                          const int& mask_gcw,
+                          const int& ilower0,
+                          const int& iupper0,
+                          const int& ilower1,
+                          const int& iupper1,
+#if (NDIM == 3)
+                          const int& ilower2,
+                          const int& iupper2,
+#endif
+                          const double* dx,
+                          const int& red_or_black);
+}
+
+// Deterministic pseudo-random value in [0,1).
+inline double
+pseudo_random(const int i, const int seed)
+{
+    const double s = sin(12.9898 * static_cast<double>(i) + 78.233 * static_cast<double>(seed + 1)) * 43758.5453;
+    return s - floor(s);
+} // pseudo_random
+
+// Perform the half sweeps one after another using the Fortran red-black
+// Gauss-Seidel smoothers, without refilling ghost cell values between them.
+void
+reference_smooth(ArrayData<NDIM, double>& U_data,
+                 const ArrayData<NDIM, double>& F_data,
+                 const ArrayData<NDIM, int>* const mask_data,
+                 const int depth,
+                 const Box<NDIM>& box,
+                 const int gcw,
+                 const double* const dx,
+                 const double alpha,
+                 const double beta,
+                 const int first_color,
+                 const int num_half_sweeps)
+{
+    double* const U = U_data.getPointer(depth);
+    const double* const F = F_data.getPointer(depth);
+    for (int m = 0; m < num_half_sweeps; ++m)
+    {
+        int red_or_black = (first_color + m) % 2; // "red" = 0, "black" = 1
+        if (mask_data)
+        {
+            RB_GS_SMOOTH_MASK_FC(U,
+                                 gcw,
+                                 alpha,
+                                 beta,
+                                 F,
+                                 gcw,
+                                 mask_data->getPointer(depth),
+                                 gcw,
+                                 box.lower(0),
+                                 box.upper(0),
+                                 box.lower(1),
+                                 box.upper(1),
+#if (NDIM == 3)
+                                 box.lower(2),
+                                 box.upper(2),
+#endif
+                                 dx,
+                                 red_or_black);
+        }
+        else
+        {
+            RB_GS_SMOOTH_FC(U,
+                            gcw,
+                            alpha,
+                            beta,
+                            F,
+                            gcw,
+                            box.lower(0),
+                            box.upper(0),
+                            box.lower(1),
+                            box.upper(1),
+#if (NDIM == 3)
+                            box.lower(2),
+                            box.upper(2),
+#endif
+                            dx,
+                            red_or_black);
+        }
+    }
+    return;
+} // reference_smooth
+
+/*******************************************************************************
+ * Regression test for the tiled red-black Gauss-Seidel smoother provided by   *
+ * PoissonSmoothers.  For each combination of masking, starting color, number  *
+ * of fused half sweeps, and tile size, the tiled kernel and the Fortran       *
+ * RED_BLACK_GAUSS_SEIDEL smoothers are applied to the same data with ghost    *
+ * cell values held fixed, and the results are required to agree to            *
+ * round-off.                                                                  *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "PoissonSmoothers.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const Array<int> box_lower = input_db->getIntegerArray("BOX_LOWER");
+        const Array<int> box_upper = input_db->getIntegerArray("BOX_UPPER");
+        const int gcw = input_db->getInteger("GHOST_CELL_WIDTH");
+        const int depth = input_db->getInteger("DEPTH");
+        const double alpha = input_db->getDouble("ALPHA");
+        const double beta = input_db->getDouble("BETA");
+        const Array<double> dx_array = input_db->getDoubleArray("DX");
+        const Array<int> tile_sizes = input_db->getIntegerArray("TILE_SIZES");
+        const Array<int> num_half_sweeps_array = input_db->getIntegerArray("NUM_HALF_SWEEPS");
+        const double mask_fraction = input_db->getDouble("MASK_FRACTION");
+        const double rel_tol = input_db->getDouble("REL_TOL");
+
+        // Setup the data.  The values of U and F are pseudo-random, including
+        // the ghost cell values of U, which are never modified.
+        Box<NDIM> box;
+        double dx[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            box.lower(d) = box_lower[d];
+            box.upper(d) = box_upper[d];
+            dx[d] = dx_array[d];
+        }
+        const Box<NDIM> ghost_box = Box<NDIM>::grow(box, gcw);
+        ArrayData<NDIM, double> U_init_data(ghost_box, depth);
+        ArrayData<NDIM, double> U_ref_data(ghost_box, depth);
+        ArrayData<NDIM, double> U_tiled_data(ghost_box, depth);
+        ArrayData<NDIM, double> F_data(ghost_box, depth);
+        ArrayData<NDIM, int> mask_data(ghost_box, depth);
+        const int num_values = U_init_data.getOffset();
+        for (int k = 0; k < depth; ++k)
+        {
+            for (int i = 0; i < num_values; ++i)
+            {
+                U_init_data.getPointer(k)[i] = 2.0 * pseudo_random(i, 3 * k) - 1.0;
+                F_data.getPointer(k)[i] = 2.0 * pseudo_random(i, 3 * k + 1) - 1.0;
+                mask_data.getPointer(k)[i] = pseudo_random(i, 3 * k + 2) < mask_fraction ? 1 : 0;
+            }
+        }
+
+        // Compare the tiled smoother to the reference smoother.
+        for (int masked = 0; masked < 2; ++masked)
+        {
+            const ArrayData<NDIM, int>* const mask = masked ? &mask_data : NULL;
+            double diff_max_norm = 0.0, U_max_norm = 0.0;
+            for (int first_color = 0; first_color < 2; ++first_color)
+            {
+                for (int n = 0; n < num_half_sweeps_array.getSize(); ++n)
+                {
+                    const int num_half_sweeps = num_half_sweeps_array[n];
+                    for (int t = 0; t < tile_sizes.getSize(); ++t)
+                    {
+                        U_ref_data.copy(U_init_data);
+                        U_tiled_data.copy(U_init_data);
+                        for (int k = 0; k < depth; ++k)
+                        {
+                            reference_smooth(U_ref_data,
+                                             F_data,
+                                             mask,
+                                             k,
+                                             box,
+                                             gcw,
+                                             dx,
+                                             alpha,
+                                             beta,
+                                             first_color,
+                                             num_half_sweeps);
+                            PoissonSmoothers::redBlackGaussSeidelSmooth(U_tiled_data,
+                                                                        F_data,
+                                                                        mask,
+                                                                        k,
+                                                                        box,
+                                                                        dx,
+                                                                        alpha,
+                                                                        beta,
+                                                                        first_color,
+                                                                        num_half_sweeps,
+                                                                        tile_sizes[t]);
+                        }
+
+                        // Compare all values, including the ghost cell values.
+                        for (int k = 0; k < depth; ++k)
+                        {
+                            const double* const U_ref = U_ref_data.getPointer(k);
+                            const double* const U_tiled = U_tiled_data.getPointer(k);
+                            for (int i = 0; i < num_values; ++i)
+                            {
+                                U_max_norm = std::max(U_max_norm, std::abs(U_ref[i]));
+                                diff_max_norm = std::max(diff_max_norm, std::abs(U_tiled[i] - U_ref[i]));
+                            }
+                        }
+                    }
+                }
+            }
+            const bool passed = U_max_norm > 0.0 && diff_max_norm <= rel_tol * U_max_norm;
+            if (!passed) ++num_failures;
+            pout << (masked ? "masked" : "unmasked") << " smoother:\n"
+                 << "  max-norm of U:              " << U_max_norm << "\n"
+                 << "  max-norm of the difference: " << diff_max_norm << "\n"
+                 << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main
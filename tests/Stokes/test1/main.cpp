@@ -0,0 +1,245 @@
+// Filename: main.cpp
+
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <LocationIndexRobinBcCoefs.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+/*******************************************************************************
+ * Regression test for StaggeredStokesOperator.  The operator is applied to a  *
+ * random vector on a locally refined grid using both the fused patch kernel   *
+ * and the separate HierarchyMathOps differencing operators, for both steady   *
+ * and unsteady velocity problem coefficients, and the results are required to *
+ * agree to round-off.                                                         *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double mu = input_db->getDouble("MU");
+        const double rho = input_db->getDouble("RHO");
+        const double dt = input_db->getDouble("DT");
+        const double rel_tol = input_db->getDoubleWithDefault("REL_TOL", 1.0e-12);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  The Navier-Stokes integrator is only used to generate
+        // the patch hierarchy.
+        Pointer<INSStaggeredHierarchyIntegrator> time_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Use homogeneous Dirichlet boundary conditions for the velocity, so
+        // that the physical boundaries are treated in the same way by both
+        // evaluations.
+        LocationIndexRobinBcCoefs<NDIM> u_bc_coef("u_bc_coef", Pointer<Database>(NULL));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            u_bc_coef.setBoundaryValue(2 * d, 0.0);
+            u_bc_coef.setBoundaryValue(2 * d + 1, 0.0);
+        }
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, &u_bc_coef);
+        time_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Setup the solution and result data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("StokesOperatorTest");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        const int A_u_fused_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+        const int A_p_fused_idx = var_db->registerClonedPatchDataIndex(p_var, p_idx);
+        const int A_u_unfused_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+        const int A_p_unfused_idx = var_db->registerClonedPatchDataIndex(p_var, p_idx);
+
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        const double loop_time = time_integrator->getIntegratorTime();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, loop_time);
+            level->allocatePatchData(p_idx, loop_time);
+            level->allocatePatchData(A_u_fused_idx, loop_time);
+            level->allocatePatchData(A_p_fused_idx, loop_time);
+            level->allocatePatchData(A_u_unfused_idx, loop_time);
+            level->allocatePatchData(A_p_unfused_idx, loop_time);
+        }
+
+        HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+        hier_math_ops.setPatchHierarchy(patch_hierarchy);
+        hier_math_ops.resetLevels(coarsest_ln, finest_ln);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, coarsest_ln, finest_ln);
+        x_vec.addComponent(u_var, u_idx, wgt_sc_idx);
+        x_vec.addComponent(p_var, p_idx, wgt_cc_idx);
+        SAMRAIVectorReal<NDIM, double> y_fused_vec("y_fused", patch_hierarchy, coarsest_ln, finest_ln);
+        y_fused_vec.addComponent(u_var, A_u_fused_idx, wgt_sc_idx);
+        y_fused_vec.addComponent(p_var, A_p_fused_idx, wgt_cc_idx);
+        SAMRAIVectorReal<NDIM, double> y_unfused_vec("y_unfused", patch_hierarchy, coarsest_ln, finest_ln);
+        y_unfused_vec.addComponent(u_var, A_u_unfused_idx, wgt_sc_idx);
+        y_unfused_vec.addComponent(p_var, A_p_unfused_idx, wgt_cc_idx);
+
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(u_bc_coefs, loop_time, patch_hierarchy);
+
+        // Compare the two evaluations for steady and unsteady problem
+        // coefficients.
+        for (int k = 0; k < 2; ++k)
+        {
+            const bool steady = k == 0;
+            PoissonSpecifications U_problem_coefs("U_problem_coefs");
+            if (steady)
+            {
+                U_problem_coefs.setCZero();
+                U_problem_coefs.setDConstant(-mu);
+            }
+            else
+            {
+                U_problem_coefs.setCConstant(rho / dt);
+                U_problem_coefs.setDConstant(-0.5 * mu);
+            }
+
+            // The random vector is regenerated for each case; both evaluations
+            // are applied to the same vector.
+            x_vec.setRandomValues(2.0, -1.0);
+
+            StaggeredStokesOperator stokes_op("stokes_op", /*homogeneous_bc*/ true);
+            stokes_op.setVelocityPoissonSpecifications(U_problem_coefs);
+            stokes_op.setPhysicalBcCoefs(u_bc_coefs, NULL);
+            stokes_op.setPhysicalBoundaryHelper(bc_helper);
+            stokes_op.setSolutionTime(loop_time);
+            stokes_op.initializeOperatorState(x_vec, y_fused_vec);
+
+            stokes_op.setFusedApplyEnabled(true);
+            stokes_op.apply(x_vec, y_fused_vec);
+            stokes_op.setFusedApplyEnabled(false);
+            stokes_op.apply(x_vec, y_unfused_vec);
+
+            const double y_max_norm = y_unfused_vec.maxNorm();
+            y_fused_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&y_fused_vec, false),
+                                 Pointer<SAMRAIVectorReal<NDIM, double> >(&y_unfused_vec, false));
+            const double diff_max_norm = y_fused_vec.maxNorm();
+            const bool passed = y_max_norm > 0.0 && diff_max_norm <= rel_tol * y_max_norm;
+            if (!passed) ++num_failures;
+            pout << (steady ? "steady" : "unsteady") << " problem coefficients:\n"
+                 << "  max-norm of A*x:            " << y_max_norm << "\n"
+                 << "  max-norm of the difference: " << diff_max_norm << "\n"
+                 << "  " << (passed ? "PASSED" : "FAILED") << "\n";
+
+            stokes_op.deallocateOperatorState();
+        }
+
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(u_idx);
+            level->deallocatePatchData(p_idx);
+            level->deallocatePatchData(A_u_fused_idx);
+            level->deallocatePatchData(A_p_fused_idx);
+            level->deallocatePatchData(A_u_unfused_idx);
+            level->deallocatePatchData(A_p_unfused_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures;
+} // main